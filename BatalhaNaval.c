@@ -1,369 +1,359 @@
-
-
 /*
  * Programa: Batalha Naval - Nível Mestre
  * Descrição: Implementa um tabuleiro 10x10 para o jogo Batalha Naval,
  *            posicionando quatro navios (horizontal, vertical e dois diagonais)
  *            e demonstrando habilidades especiais com áreas de efeito
  *            (Cone, Cruz e Octaedro) com validação de limites e sobreposição.
+ *            O motor do jogo fica na biblioteca de src/; este programa é um
+ *            dos seus clientes.
  * Autor: Desenvolvido como desafio de programação
  * Data: 2026
+ * Compilação: cmake -S . -B build && cmake --build build
+ *             (ou gcc -O2 -Iinclude -Isrc -pthread com BatalhaNaval.c e todos os .c de src/)
  */
 
-#include <stdio.h>
+#include "batalha_naval_interno.h"
+
+// ========== MÉTRICAS ==========
 
-// Definição de constantes para facilitar manutenção e legibilidade
-#define TAMANHO_TABULEIRO 10  // Tamanho fixo do tabuleiro (10x10)
-#define TAMANHO_NAVIO 3       // Tamanho fixo de cada navio (3 posições)
-#define AGUA 0                // Valor que representa água no tabuleiro
-#define NAVIO 3               // Valor que representa parte de um navio
-#define HABILIDADE 5          // Valor que representa área afetada por habilidade especial
-#define TAMANHO_MATRIZ_HABILIDADE 7  // Tamanho das matrizes de habilidade (7x7)
+#define INTERVALO_METRICAS 1.0  // Segundos entre duas gravações do arquivo de métricas
 
 /*
- * Função: inicializarTabuleiro
- * Propósito: Inicializa todas as posições do tabuleiro com o valor 0 (água)
- * Parâmetros:
- *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
+ * Função: iniciarMetricasDoAmbiente
+ * Propósito: Liga a exportação periódica de métricas se BATALHA_NAVAL_METRICAS
+ *            estiver definida; a última gravação acontece na saída do programa
  * Retorno: void (não retorna valor)
  */
-void inicializarTabuleiro(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]) {
-    // Loop aninhado para percorrer todas as linhas e colunas
-    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
-        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
-            tabuleiro[i][j] = AGUA;  // Inicializa cada posição com água
-        }
-    }
-}
+static void iniciarMetricasDoAmbiente(void) {
+    const char *caminho = getenv("BATALHA_NAVAL_METRICAS");
+    size_t tamanho;
+    FormatoMetricas formato = METRICAS_JSON;
 
-/*
- * Função: validarPosicao
- * Propósito: Verifica se um navio cabe dentro dos limites do tabuleiro
- * Parâmetros:
- *   - linha: linha inicial do navio
- *   - coluna: coluna inicial do navio
- *   - tamanho: quantidade de posições que o navio ocupa
- *   - orientacao: 'H' para horizontal, 'V' para vertical,
- *                 'D' para diagonal baixo-direita, 'E' para diagonal baixo-esquerda
- * Retorno: 1 se a posição é válida, 0 se é inválida
- */
-int validarPosicao(int linha, int coluna, int tamanho, char orientacao) {
-    // Valida se a linha e coluna iniciais estão dentro do tabuleiro
-    if (linha < 0 || linha >= TAMANHO_TABULEIRO ||
-        coluna < 0 || coluna >= TAMANHO_TABULEIRO) {
-        return 0;  // Posição inicial inválida
-    }
-
-    // Valida orientação horizontal
-    if (orientacao == 'H' || orientacao == 'h') {
-        // Verifica se o navio cabe horizontalmente
-        if (coluna + tamanho > TAMANHO_TABULEIRO) {
-            return 0;  // Navio ultrapassa o limite à direita
-        }
+    if (caminho == NULL || caminho[0] == '\0') {
+        return;
     }
-    // Valida orientação vertical
-    else if (orientacao == 'V' || orientacao == 'v') {
-        // Verifica se o navio cabe verticalmente
-        if (linha + tamanho > TAMANHO_TABULEIRO) {
-            return 0;  // Navio ultrapassa o limite inferior
-        }
-    }
-    // Valida orientação diagonal para baixo-direita (↘)
-    else if (orientacao == 'D' || orientacao == 'd') {
-        // Verifica se o navio cabe na diagonal (linha e coluna aumentam)
-        if (linha + tamanho > TAMANHO_TABULEIRO ||
-            coluna + tamanho > TAMANHO_TABULEIRO) {
-            return 0;  // Navio ultrapassa os limites
-        }
+    tamanho = strlen(caminho);
+    if (tamanho >= 5 && strcmp(caminho + tamanho - 5, ".prom") == 0) {
+        formato = METRICAS_PROMETHEUS;
     }
-    // Valida orientação diagonal para baixo-esquerda (↙)
-    else if (orientacao == 'E' || orientacao == 'e') {
-        // Verifica se o navio cabe na diagonal (linha aumenta, coluna diminui)
-        if (linha + tamanho > TAMANHO_TABULEIRO ||
-            coluna - tamanho + 1 < 0) {
-            return 0;  // Navio ultrapassa os limites
-        }
-    }
-    else {
-        return 0;  // Orientação inválida
+    if (iniciarExportacaoMetricas(caminho, formato, INTERVALO_METRICAS) != 0 ||
+        atexit(pararExportacaoMetricas) != 0) {
+        printf("AVISO: Nao foi possivel exportar metricas para %s.\n", caminho);
     }
-
-    return 1;  // Posição válida
 }
 
+// ========== MODOS DE LINHA DE COMANDO ==========
+
 /*
- * Função: verificarSobreposicao
- * Propósito: Verifica se as posições que o navio ocupará já estão ocupadas
+ * Função: executarModoSimulacao
+ * Propósito: Trata a linha de comando "simular <partidas> [threads] [semente] [caca|aleatoria]"
  * Parâmetros:
- *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
- *   - linha: linha inicial do navio
- *   - coluna: coluna inicial do navio
- *   - tamanho: quantidade de posições que o navio ocupa
- *   - orientacao: 'H' para horizontal, 'V' para vertical,
- *                 'D' para diagonal baixo-direita, 'E' para diagonal baixo-esquerda
- * Retorno: 1 se houver sobreposição, 0 se estiver livre
+ *   - argc, argv: argumentos recebidos por main, a partir do nome do modo
+ * Retorno: código de saída do programa
  */
-int verificarSobreposicao(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
-                          int linha, int coluna, int tamanho, char orientacao) {
-    // Verifica sobreposição para navio horizontal
-    if (orientacao == 'H' || orientacao == 'h') {
-        // Percorre todas as colunas que o navio ocupará
-        for (int j = coluna; j < coluna + tamanho; j++) {
-            if (tabuleiro[linha][j] != AGUA) {
-                return 1;  // Há sobreposição
-            }
-        }
-    }
-    // Verifica sobreposição para navio vertical
-    else if (orientacao == 'V' || orientacao == 'v') {
-        // Percorre todas as linhas que o navio ocupará
-        for (int i = linha; i < linha + tamanho; i++) {
-            if (tabuleiro[i][coluna] != AGUA) {
-                return 1;  // Há sobreposição
-            }
-        }
+static int executarModoSimulacao(int argc, char *argv[]) {
+    ConfiguracaoSimulacao configuracao = {1000000, 0, 2026, POLITICA_CACA, FROTA_UNIFORME};
+    ResultadoSimulacao resultado;
+
+    if (argc > 1) configuracao.partidas = atoll(argv[1]);
+    if (argc > 2) configuracao.threads = atoi(argv[2]);
+    if (argc > 3) configuracao.semente = strtoull(argv[3], NULL, 10);
+    if (argc > 4 && strcmp(argv[4], "aleatoria") == 0) configuracao.politica = POLITICA_ALEATORIA;
+
+    if (configuracao.partidas <= 0) {
+        printf("ERRO: Quantidade de partidas invalida.\n");
+        return 1;
     }
-    // Verifica sobreposição para navio diagonal baixo-direita (↘)
-    else if (orientacao == 'D' || orientacao == 'd') {
-        // Percorre as posições na diagonal (linha e coluna aumentam)
-        for (int i = 0; i < tamanho; i++) {
-            if (tabuleiro[linha + i][coluna + i] != AGUA) {
-                return 1;  // Há sobreposição
-            }
-        }
+    if (simularPartidas(&configuracao, &resultado) != 0) {
+        printf("ERRO: Nao foi possivel iniciar a simulacao.\n");
+        return 1;
     }
-    // Verifica sobreposição para navio diagonal baixo-esquerda (↙)
-    else if (orientacao == 'E' || orientacao == 'e') {
-        // Percorre as posições na diagonal (linha aumenta, coluna diminui)
-        for (int i = 0; i < tamanho; i++) {
-            if (tabuleiro[linha + i][coluna - i] != AGUA) {
-                return 1;  // Há sobreposição
-            }
+
+    printf("Partidas simuladas: %lld (%d threads, politica %s)\n", resultado.partidas,
+           resultado.threadsUsadas,
+           configuracao.politica == POLITICA_CACA ? "caca" : "aleatoria");
+    printf("Tempo: %.3f s (%.0f partidas/s)\n", resultado.segundos,
+           resultado.partidasPorSegundo);
+    printf("Media de tiros para vencer: %.2f\n", resultado.mediaTiros);
+    printf("Distribuicao de tiros para vencer:\n");
+    for (int n = 0; n <= CELULAS_TABULEIRO; n++) {
+        if (resultado.histograma[n] > 0) {
+            printf("  %3d tiros: %lld\n", n, resultado.histograma[n]);
         }
     }
-
-    return 0;  // Não há sobreposição
+    return 0;
 }
 
 /*
- * Função: posicionarNavio
- * Propósito: Posiciona um navio no tabuleiro, marcando suas posições com o valor 3
+ * Função: executarModoGravacao
+ * Propósito: Trata "gravar <arquivo> <partidas> [semente] [caca|aleatoria]":
+ *            joga partidas em uma thread e grava cada frota com seus tiros
  * Parâmetros:
- *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
- *   - linha: linha inicial do navio
- *   - coluna: coluna inicial do navio
- *   - orientacao: 'H' para horizontal, 'V' para vertical,
- *                 'D' para diagonal baixo-direita, 'E' para diagonal baixo-esquerda
- * Retorno: void (não retorna valor)
- * Nota: Assume que a validação já foi feita antes de chamar esta função
+ *   - argc, argv: argumentos recebidos por main, a partir do nome do modo
+ * Retorno: código de saída do programa
  */
-void posicionarNavio(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
-                     int linha, int coluna, char orientacao) {
-    // Posiciona navio horizontal
-    if (orientacao == 'H' || orientacao == 'h') {
-        // Marca cada posição do navio horizontalmente
-        for (int j = coluna; j < coluna + TAMANHO_NAVIO; j++) {
-            tabuleiro[linha][j] = NAVIO;
-        }
+static int executarModoGravacao(int argc, char *argv[]) {
+    EscritorRegistros escritor;
+    GeradorAleatorio gerador;
+    PoliticaTiro politica = POLITICA_CACA;
+    long long partidas = argc > 2 ? atoll(argv[2]) : 100000;
+    uint64_t semente = argc > 3 ? strtoull(argv[3], NULL, 10) : 2026;
+
+    if (argc > 4 && strcmp(argv[4], "aleatoria") == 0) politica = POLITICA_ALEATORIA;
+    if (argc < 2 || partidas <= 0) {
+        printf("ERRO: Uso: gravar <arquivo> <partidas> [semente] [caca|aleatoria]\n");
+        return 1;
     }
-    // Posiciona navio vertical
-    else if (orientacao == 'V' || orientacao == 'v') {
-        // Marca cada posição do navio verticalmente
-        for (int i = linha; i < linha + TAMANHO_NAVIO; i++) {
-            tabuleiro[i][coluna] = NAVIO;
-        }
+    if (abrirEscritorRegistros(&escritor, argv[1]) != 0) {
+        printf("ERRO: Nao foi possivel criar o arquivo %s.\n", argv[1]);
+        return 1;
     }
-    // Posiciona navio diagonal para baixo-direita (↘)
-    else if (orientacao == 'D' || orientacao == 'd') {
-        // Marca cada posição do navio na diagonal (linha e coluna aumentam)
-        for (int i = 0; i < TAMANHO_NAVIO; i++) {
-            tabuleiro[linha + i][coluna + i] = NAVIO;
+
+    semearGerador(&gerador, semente);
+    double inicio = relogioSegundos();
+    for (long long i = 0; i < partidas; i++) {
+        TabuleiroBits tabuleiro;
+        unsigned char sequencia[CELULAS_TABULEIRO];
+        int tiros = jogarPartidaRegistrada(&gerador, politica, FROTA_UNIFORME, &tabuleiro, sequencia);
+        if (gravarPartida(&escritor, tabuleiro.navios, sequencia, tiros, NULL, 0) != 0) {
+            fecharEscritorRegistros(&escritor);
+            printf("ERRO: Falha ao gravar o arquivo %s.\n", argv[1]);
+            return 1;
         }
     }
-    // Posiciona navio diagonal para baixo-esquerda (↙)
-    else if (orientacao == 'E' || orientacao == 'e') {
-        // Marca cada posição do navio na diagonal (linha aumenta, coluna diminui)
-        for (int i = 0; i < TAMANHO_NAVIO; i++) {
-            tabuleiro[linha + i][coluna - i] = NAVIO;
-        }
+    if (fecharEscritorRegistros(&escritor) != 0) {
+        printf("ERRO: Falha ao gravar o arquivo %s.\n", argv[1]);
+        return 1;
     }
+
+    printf("Partidas gravadas: %lld em %.3f s\n", partidas, relogioSegundos() - inicio);
+    return 0;
 }
 
 /*
- * Função: exibirTabuleiro
- * Propósito: Exibe o tabuleiro no console de forma organizada e legível
+ * Função: executarModoReproducao
+ * Propósito: Trata "reproduzir <arquivo>": percorre o arquivo mapeado, refaz
+ *            cada partida em um tabuleiro em bits e confere o resultado
  * Parâmetros:
- *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
- * Retorno: void (não retorna valor)
+ *   - argc, argv: argumentos recebidos por main, a partir do nome do modo
+ * Retorno: código de saída do programa
  */
-void exibirTabuleiro(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]) {
-    printf("\n=== TABULEIRO DE BATALHA NAVAL ===\n\n");
-
-    // Exibe cabeçalho com números das colunas
-    printf("   ");  // Espaço para alinhamento
-    for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
-        printf(" %d", j);
+static int executarModoReproducao(int argc, char *argv[]) {
+    LeitorRegistros leitor;
+    RegistroPartida partida;
+    long long partidas = 0, vencidas = 0, somaTiros = 0;
+    int estado;
+
+    if (argc < 2 || abrirLeitorRegistros(&leitor, argv[1]) != 0) {
+        printf("ERRO: Nao foi possivel abrir o arquivo de registros.\n");
+        return 1;
     }
-    printf("\n");
 
-    // Exibe cada linha do tabuleiro
-    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
-        printf("%d  ", i);  // Número da linha
+    double inicio = relogioSegundos();
+    while ((estado = proximaPartida(&leitor, &partida)) == 1) {
+        TabuleiroBits tabuleiro;
+        inicializarTabuleiroBits(&tabuleiro);
+        tabuleiro.navios = desempacotarOcupacao(partida.ocupacao);
+        tabuleiro.hash = hashTabuleiroBits(&tabuleiro);
+        for (int t = 0; t < partida.quantidadeTiros; t++) {
+            registrarTiroBits(&tabuleiro, partida.tiros[t]);
+        }
 
-        // Exibe cada coluna da linha atual
-        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
-            printf(" %d", tabuleiro[i][j]);
+        const unsigned char *cursor = partida.efeitos;
+        for (int e = 0; e < partida.quantidadeEfeitos; e++) {
+            EfeitoHabilidade efeito;
+            if (!lerEfeitoRegistrado(&cursor, partida.fim, &efeito)) {
+                estado = -1;
+                break;
+            }
+            aplicarFormaBits(&tabuleiro, efeito.forma, efeito.linha, efeito.coluna);
+        }
+        if (estado < 0) {
+            break;
         }
-        printf("\n");
+
+        partidas++;
+        somaTiros += partida.quantidadeTiros;
+        vencidas += bitboardEstaVazio(bitboardENao(tabuleiro.navios, tabuleiro.tiros));
     }
+    double segundos = relogioSegundos() - inicio;
+    size_t tamanho = leitor.tamanho;
+    fecharLeitorRegistros(&leitor);
 
-    printf("\n");
-    printf("Legenda: 0 = Agua, 3 = Navio, 5 = Area de Habilidade\n");
+    if (estado < 0) {
+        printf("ERRO: Arquivo de registros corrompido apos %lld partidas.\n", partidas);
+        return 1;
+    }
+    printf("Partidas reproduzidas: %lld (%lld com a frota afundada)\n", partidas, vencidas);
+    printf("Media de tiros: %.2f\n", partidas > 0 ? (double)somaTiros / (double)partidas : 0.0);
+    printf("Tempo: %.3f s (%.1f MB/s)\n", segundos,
+           segundos > 0 ? (double)tamanho / segundos / 1e6 : 0.0);
+    return 0;
 }
 
+// ========== CLIENTE LOCAL DO SERVIDOR DE PARTIDAS ==========
+
+#define LOTE_TIROS_CLIENTE 8  // Tiros enviados de uma vez por partida
+
 /*
- * Função: copiarTabuleiro
- * Propósito: Cria uma cópia do tabuleiro para preservar o original
- * Parâmetros:
- *   - origem: matriz 10x10 que será copiada
- *   - destino: matriz 10x10 que receberá a cópia
- * Retorno: void (não retorna valor)
+ * Tipo: ClienteLocal
+ * Propósito: Jogador de uma partida do servidor, no mesmo processo. Reage às
+ *            respostas do servidor enviando o próximo lote de tiros.
+ * Campos:
+ *   - servidor, partida: onde o cliente joga
+ *   - ordem: células na ordem em que serão atingidas (embaralhadas)
+ *   - enviados: tiros já enviados
+ *   - pendentes: jogadas enviadas ainda sem resposta
+ *   - resolvidas: respostas recebidas
+ *   - tirosAteVencer: tiros aceitos até o último navio afundar (0 = não venceu)
+ *   - recusadas: jogadas recusadas antes do fim da partida (deve ficar em 0)
  */
-void copiarTabuleiro(int origem[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
-                     int destino[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]) {
-    // Loop aninhado para copiar cada posição
-    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
-        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
-            destino[i][j] = origem[i][j];
-        }
+typedef struct {
+    ServidorPartidas *servidor;
+    uint64_t partida;
+    unsigned char ordem[CELULAS_TABULEIRO];
+    int enviados;
+    int pendentes;
+    int resolvidas;
+    int tirosAteVencer;
+    int recusadas;
+} ClienteLocal;
+
+// Envia ao servidor o próximo lote de tiros do cliente, precedido pela jogada inicial
+static void enviarLoteCliente(ClienteLocal *cliente, const Jogada *inicial) {
+    Jogada lote[LOTE_TIROS_CLIENTE + 1];
+    int quantidade = 0;
+    int limite = LOTE_TIROS_CLIENTE;
+
+    if (inicial != NULL) {
+        lote[quantidade++] = *inicial;
+        limite++;
+    }
+    while (quantidade < limite && cliente->enviados < CELULAS_TABULEIRO) {
+        Jogada tiro = {JOGADA_TIRO, 0, 0, 0, 0, 0, 0};
+        tiro.linha = (signed char)(cliente->ordem[cliente->enviados] / TAMANHO_TABULEIRO);
+        tiro.coluna = (signed char)(cliente->ordem[cliente->enviados] % TAMANHO_TABULEIRO);
+        lote[quantidade++] = tiro;
+        cliente->enviados++;
+    }
+    cliente->pendentes = quantidade;
+    if (enviarJogadas(cliente->servidor, cliente->partida, lote, quantidade) != 0) {
+        cliente->pendentes = 0;
+        cliente->recusadas += quantidade;
     }
 }
 
-/*
- * Função: criarMatrizCone
- * Propósito: Cria dinamicamente uma matriz representando área de efeito em forma de cone
- * Parâmetros:
- *   - matriz: matriz 7x7 que receberá o padrão de cone
- * Retorno: void (não retorna valor)
- * Lógica: O cone expande do topo (linha 0) para baixo, aumentando largura
- */
-void criarMatrizCone(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]) {
-    int centro = TAMANHO_MATRIZ_HABILIDADE / 2;  // Centro da matriz (índice 3 para 7x7)
-
-    // Loop aninhado para percorrer toda a matriz
-    for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
-        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
-            // Lógica do cone: expandir a partir do centro conforme linha aumenta
-            // Na linha 0: apenas centro
-            // Na linha 1: centro +/- 1
-            // Na linha 2: centro +/- 2
-            // Quando atinge largura máxima, continua preenchido
-            if (i <= centro) {
-                // Fase de expansão: largura aumenta com a linha
-                if (j >= centro - i && j <= centro + i) {
-                    matriz[i][j] = 1;
-                } else {
-                    matriz[i][j] = 0;
-                }
-            } else {
-                // Após atingir largura máxima, mantém tudo preenchido
-                matriz[i][j] = 1;
-            }
-        }
+// Resposta do servidor: contabiliza a jogada e, ao fim do lote, envia o próximo
+static void responderClienteLocal(void *contexto, uint64_t partida, const Jogada *jogada,
+                                  int resultado) {
+    ClienteLocal *cliente = contexto;
+    (void)partida;
+
+    cliente->resolvidas++;
+    if (jogada->tipo == JOGADA_TIRO && resultado == TIRO_FIM_DE_JOGO) {
+        cliente->tirosAteVencer = cliente->enviados - cliente->pendentes + 1;
+    } else if (resultado < 0 && cliente->tirosAteVencer == 0) {
+        cliente->recusadas++;
+    }
+    if (--cliente->pendentes == 0 && cliente->tirosAteVencer == 0 &&
+        cliente->enviados < CELULAS_TABULEIRO) {
+        enviarLoteCliente(cliente, NULL);
     }
 }
 
 /*
- * Função: criarMatrizCruz
- * Propósito: Cria dinamicamente uma matriz representando área de efeito em forma de cruz
+ * Função: executarModoServidor
+ * Propósito: Trata "servidor <partidas> [threads] [semente]": hospeda muitas partidas
+ *            simultâneas no servidor e as joga até o fim com clientes locais
  * Parâmetros:
- *   - matriz: matriz 7x7 que receberá o padrão de cruz
- * Retorno: void (não retorna valor)
- * Lógica: Marca linha central E coluna central, formando uma cruz
+ *   - argc, argv: argumentos recebidos por main, a partir do nome do modo
+ * Retorno: código de saída do programa
  */
-void criarMatrizCruz(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]) {
-    int centro = TAMANHO_MATRIZ_HABILIDADE / 2;  // Centro da matriz (índice 3 para 7x7)
-
-    // Loop aninhado para percorrer toda a matriz
-    for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
-        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
-            // Lógica da cruz: marcar se está na linha central OU na coluna central
-            if (i == centro || j == centro) {
-                matriz[i][j] = 1;
-            } else {
-                matriz[i][j] = 0;
-            }
-        }
+static int executarModoServidor(int argc, char *argv[]) {
+    ConfiguracaoServidor configuracao = {0, responderClienteLocal};
+    long long partidas = argc > 1 ? atoll(argv[1]) : 10000;
+    uint64_t semente = argc > 3 ? strtoull(argv[3], NULL, 10) : 2026;
+    long long encerradas = 0, somaTiros = 0, jogadas = 0, recusadas = 0;
+    GeradorAleatorio gerador;
+    ServidorPartidas *servidor;
+    ClienteLocal *clientes;
+
+    if (argc > 2) configuracao.threads = atoi(argv[2]);
+    if (partidas <= 0) {
+        printf("ERRO: Quantidade de partidas invalida.\n");
+        return 1;
+    }
+    clientes = malloc(sizeof(ClienteLocal) * (size_t)partidas);
+    servidor = clientes != NULL ? criarServidorPartidas(&configuracao) : NULL;
+    if (servidor == NULL) {
+        free(clientes);
+        printf("ERRO: Nao foi possivel iniciar o servidor.\n");
+        return 1;
     }
-}
 
-/*
- * Função: criarMatrizOctaedro
- * Propósito: Cria dinamicamente uma matriz representando área de efeito em forma de losango
- * Parâmetros:
- *   - matriz: matriz 7x7 que receberá o padrão de losango (vista frontal de octaedro)
- * Retorno: void (não retorna valor)
- * Lógica: Usa distância Manhattan para criar formato de diamante
- */
-void criarMatrizOctaedro(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]) {
-    int centro = TAMANHO_MATRIZ_HABILIDADE / 2;  // Centro da matriz (índice 3 para 7x7)
-
-    // Loop aninhado para percorrer toda a matriz
-    for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
-        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
-            // Lógica do octaedro/losango: usar distância Manhattan
-            // Distância Manhattan = |linha - centro| + |coluna - centro|
-            // Se distância <= raio (centro), está dentro do losango
-            int distancia = abs(i - centro) + abs(j - centro);
-
-            if (distancia <= centro) {
-                matriz[i][j] = 1;
-            } else {
-                matriz[i][j] = 0;
-            }
+    semearGerador(&gerador, semente);
+    double inicio = relogioSegundos();
+    for (long long i = 0; i < partidas; i++) {
+        ClienteLocal *cliente = &clientes[i];
+        Jogada frota = {JOGADA_SORTEAR_FROTA, 0, 0, 0, 0, 0, 0};
+
+        cliente->servidor = servidor;
+        cliente->enviados = 0;
+        cliente->resolvidas = 0;
+        cliente->tirosAteVencer = 0;
+        cliente->recusadas = 0;
+        // Ordem de tiro embaralhada (Fisher-Yates), sem repetir células
+        for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+            cliente->ordem[c] = (unsigned char)c;
         }
-    }
-}
+        for (int c = CELULAS_TABULEIRO - 1; c > 0; c--) {
+            int j = (int)aleatorioAte(&gerador, (uint32_t)(c + 1));
+            unsigned char troca = cliente->ordem[c];
+            cliente->ordem[c] = cliente->ordem[j];
+            cliente->ordem[j] = troca;
+        }
+        frota.semente = proximoAleatorio(&gerador);
 
-/*
- * Função: aplicarHabilidade
- * Propósito: Sobrepõe a matriz de habilidade no tabuleiro, centrando no ponto de origem
- * Parâmetros:
- *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
- *   - matrizHabilidade: matriz 7x7 representando a área de efeito
- *   - origem_linha: linha central onde a habilidade será aplicada
- *   - origem_coluna: coluna central onde a habilidade será aplicada
- * Retorno: void (não retorna valor)
- * Lógica: Sobrepõe a matriz centralizando no ponto de origem, respeitando limites
- */
-void aplicarHabilidade(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
-                       int matrizHabilidade[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE],
-                       int origem_linha, int origem_coluna) {
-    int deslocamento = TAMANHO_MATRIZ_HABILIDADE / 2;  // Deslocamento para centralizar (3 para 7x7)
-
-    // Loop aninhado para percorrer a matriz de habilidade
-    for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
-        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
-            // Calcular posição correspondente no tabuleiro
-            // Subtrair deslocamento para centralizar a matriz no ponto de origem
-            int tab_i = origem_linha - deslocamento + i;
-            int tab_j = origem_coluna - deslocamento + j;
-
-            // Verificar se a posição está dentro dos limites do tabuleiro
-            if (tab_i >= 0 && tab_i < TAMANHO_TABULEIRO &&
-                tab_j >= 0 && tab_j < TAMANHO_TABULEIRO) {
-
-                // Se a posição da matriz de habilidade está marcada (valor 1)
-                // E a posição no tabuleiro é água (valor 0), aplicar habilidade
-                if (matrizHabilidade[i][j] == 1 && tabuleiro[tab_i][tab_j] == AGUA) {
-                    tabuleiro[tab_i][tab_j] = HABILIDADE;
-                }
-                // Nota: Não sobrescrever navios (valor 3)
-            }
+        if (criarPartida(servidor, cliente, &cliente->partida) != 0) {
+            destruirServidorPartidas(servidor);
+            free(clientes);
+            printf("ERRO: Nao foi possivel criar a partida %lld.\n", i);
+            return 1;
+        }
+        enviarLoteCliente(cliente, &frota);
+    }
+    aguardarServidor(servidor);
+    double segundos = relogioSegundos() - inicio;
+
+    // Confere o estado final de cada partida com o que o cliente observou
+    for (long long i = 0; i < partidas; i++) {
+        EstadoPartida estado;
+        // Partida sumida do servidor conta como não encerrada
+        if (consultarPartida(servidor, clientes[i].partida, &estado) == 0 &&
+            estado.fase == PARTIDA_ENCERRADA && estado.tiros == clientes[i].tirosAteVencer) {
+            encerradas++;
         }
+        somaTiros += clientes[i].tirosAteVencer;
+        jogadas += clientes[i].resolvidas;
+        recusadas += clientes[i].recusadas;
     }
+
+    printf("Partidas simultaneas: %lld (%d threads, %d fragmentos)\n", partidas,
+           threadsPoolTrabalho(poolServidor(servidor)), QUANTIDADE_FRAGMENTOS);
+    printf("Partidas encerradas: %lld (%lld jogadas recusadas)\n", encerradas, recusadas);
+    printf("Jogadas resolvidas: %lld em %.3f s (%.0f jogadas/s)\n", jogadas, segundos,
+           segundos > 0 ? (double)jogadas / segundos : 0.0);
+    printf("Media de tiros para vencer: %.2f\n",
+           partidas > 0 ? (double)somaTiros / (double)partidas : 0.0);
+    printf("Tarefas roubadas entre threads: %lld\n", roubosPoolTrabalho(poolServidor(servidor)));
+
+    destruirServidorPartidas(servidor);
+    free(clientes);
+    return encerradas == partidas ? 0 : 1;
 }
 
+// ========== DEMONSTRAÇÃO ==========
+
 /*
  * Função: main
  * Propósito: Função principal que coordena a execução do programa
@@ -374,14 +364,47 @@ void aplicarHabilidade(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
  *   4. Posiciona terceiro navio (diagonal baixo-direita)
  *   5. Posiciona quarto navio (diagonal baixo-esquerda)
  *   6. Exibe o tabuleiro final
+ * Modos:
+ *   - sem argumentos: executa a demonstração acima
+ *   - silencioso: executa a demonstração exibindo apenas erros
+ *   - fluxo: executa a demonstração com uma linha compacta por tabuleiro
+ *   - simular <partidas> [threads] [semente] [caca|aleatoria]: simulação de Monte Carlo
+ *   - gravar <arquivo> <partidas> [semente] [caca|aleatoria]: grava partidas em binário
+ *   - reproduzir <arquivo>: refaz as partidas de um arquivo gravado
+ *   - servidor <partidas> [threads] [semente]: partidas simultâneas no servidor
+ * Métricas: com a variável de ambiente BATALHA_NAVAL_METRICAS=<arquivo>, as
+ *           estatísticas da instrumentação são regravadas nesse arquivo a cada
+ *           segundo (formato Prometheus se terminar em .prom, JSON caso contrário)
  */
-int main() {
-    // Declaração da matriz que representa o tabuleiro
-    int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
+int main(int argc, char *argv[]) {
+    iniciarMetricasDoAmbiente();
+
+    if (argc > 1 && strcmp(argv[1], "simular") == 0) {
+        return executarModoSimulacao(argc - 1, argv + 1);
+    }
+    if (argc > 1 && strcmp(argv[1], "gravar") == 0) {
+        return executarModoGravacao(argc - 1, argv + 1);
+    }
+    if (argc > 1 && strcmp(argv[1], "reproduzir") == 0) {
+        return executarModoReproducao(argc - 1, argv + 1);
+    }
+    if (argc > 1 && strcmp(argv[1], "servidor") == 0) {
+        return executarModoServidor(argc - 1, argv + 1);
+    }
+    if (argc > 1 && strcmp(argv[1], "silencioso") == 0) {
+        definirModoSaida(SAIDA_SILENCIOSA);
+    } else if (argc > 1 && strcmp(argv[1], "fluxo") == 0) {
+        definirModoSaida(SAIDA_FLUXO);
+    } else {
+        definirModoSaida(SAIDA_NORMAL);
+    }
+
+    // Declaração do tabuleiro em bits (camadas de navios e de habilidade)
+    TabuleiroBits tabuleiro;
 
     // Passo 1: Inicializar tabuleiro com água em todas as posições
-    inicializarTabuleiro(tabuleiro);
-    printf("Tabuleiro inicializado com sucesso!\n");
+    inicializarTabuleiroBits(&tabuleiro);
+    mensagem("Tabuleiro inicializado com sucesso!\n");
 
     // ========== POSICIONAMENTO DO PRIMEIRO NAVIO (HORIZONTAL) ==========
 
@@ -390,8 +413,8 @@ int main() {
     int navio1_coluna = 1;
     char navio1_orientacao = 'H';  // H = Horizontal
 
-    printf("\nPosicionando Navio 1 (Horizontal)...\n");
-    printf("  Posicao inicial: linha %d, coluna %d\n", navio1_linha, navio1_coluna);
+    mensagem("\nPosicionando Navio 1 (Horizontal)...\n");
+    mensagem("  Posicao inicial: linha %d, coluna %d\n", navio1_linha, navio1_coluna);
 
     // Validar se o navio cabe no tabuleiro
     if (!validarPosicao(navio1_linha, navio1_coluna, TAMANHO_NAVIO, navio1_orientacao)) {
@@ -400,16 +423,16 @@ int main() {
     }
 
     // Verificar se há sobreposição
-    if (verificarSobreposicao(tabuleiro, navio1_linha, navio1_coluna,
-                              TAMANHO_NAVIO, navio1_orientacao)) {
+    if (verificarSobreposicaoBits(&tabuleiro, navio1_linha, navio1_coluna,
+                                  TAMANHO_NAVIO, navio1_orientacao)) {
         printf("  ERRO: Sobreposicao detectada!\n");
         return 1;  // Encerra o programa com código de erro
     }
 
     // Posicionar o navio
-    posicionarNavio(tabuleiro, navio1_linha, navio1_coluna, navio1_orientacao);
-    printf("  Navio 1 posicionado com sucesso!\n");
-    printf("  Ocupa as posicoes: (%d,%d), (%d,%d), (%d,%d)\n",
+    posicionarNavioBits(&tabuleiro, navio1_linha, navio1_coluna, navio1_orientacao);
+    mensagem("  Navio 1 posicionado com sucesso!\n");
+    mensagem("  Ocupa as posicoes: (%d,%d), (%d,%d), (%d,%d)\n",
            navio1_linha, navio1_coluna,
            navio1_linha, navio1_coluna + 1,
            navio1_linha, navio1_coluna + 2);
@@ -421,8 +444,8 @@ int main() {
     int navio2_coluna = 7;
     char navio2_orientacao = 'V';  // V = Vertical
 
-    printf("\nPosicionando Navio 2 (Vertical)...\n");
-    printf("  Posicao inicial: linha %d, coluna %d\n", navio2_linha, navio2_coluna);
+    mensagem("\nPosicionando Navio 2 (Vertical)...\n");
+    mensagem("  Posicao inicial: linha %d, coluna %d\n", navio2_linha, navio2_coluna);
 
     // Validar se o navio cabe no tabuleiro
     if (!validarPosicao(navio2_linha, navio2_coluna, TAMANHO_NAVIO, navio2_orientacao)) {
@@ -431,16 +454,16 @@ int main() {
     }
 
     // Verificar se há sobreposição com navios já posicionados
-    if (verificarSobreposicao(tabuleiro, navio2_linha, navio2_coluna,
-                              TAMANHO_NAVIO, navio2_orientacao)) {
+    if (verificarSobreposicaoBits(&tabuleiro, navio2_linha, navio2_coluna,
+                                  TAMANHO_NAVIO, navio2_orientacao)) {
         printf("  ERRO: Sobreposicao detectada! Navio conflita com outro navio.\n");
         return 1;  // Encerra o programa com código de erro
     }
 
     // Posicionar o navio
-    posicionarNavio(tabuleiro, navio2_linha, navio2_coluna, navio2_orientacao);
-    printf("  Navio 2 posicionado com sucesso!\n");
-    printf("  Ocupa as posicoes: (%d,%d), (%d,%d), (%d,%d)\n",
+    posicionarNavioBits(&tabuleiro, navio2_linha, navio2_coluna, navio2_orientacao);
+    mensagem("  Navio 2 posicionado com sucesso!\n");
+    mensagem("  Ocupa as posicoes: (%d,%d), (%d,%d), (%d,%d)\n",
            navio2_linha, navio2_coluna,
            navio2_linha + 1, navio2_coluna,
            navio2_linha + 2, navio2_coluna);
@@ -452,8 +475,8 @@ int main() {
     int navio3_coluna = 0;
     char navio3_orientacao = 'D';  // D = Diagonal baixo-direita (↘)
 
-    printf("\nPosicionando Navio 3 (Diagonal Baixo-Direita)...\n");
-    printf("  Posicao inicial: linha %d, coluna %d\n", navio3_linha, navio3_coluna);
+    mensagem("\nPosicionando Navio 3 (Diagonal Baixo-Direita)...\n");
+    mensagem("  Posicao inicial: linha %d, coluna %d\n", navio3_linha, navio3_coluna);
 
     // Validar se o navio cabe no tabuleiro
     if (!validarPosicao(navio3_linha, navio3_coluna, TAMANHO_NAVIO, navio3_orientacao)) {
@@ -462,16 +485,16 @@ int main() {
     }
 
     // Verificar se há sobreposição com navios já posicionados
-    if (verificarSobreposicao(tabuleiro, navio3_linha, navio3_coluna,
-                              TAMANHO_NAVIO, navio3_orientacao)) {
+    if (verificarSobreposicaoBits(&tabuleiro, navio3_linha, navio3_coluna,
+                                  TAMANHO_NAVIO, navio3_orientacao)) {
         printf("  ERRO: Sobreposicao detectada! Navio conflita com outro navio.\n");
         return 1;  // Encerra o programa com código de erro
     }
 
     // Posicionar o navio
-    posicionarNavio(tabuleiro, navio3_linha, navio3_coluna, navio3_orientacao);
-    printf("  Navio 3 posicionado com sucesso!\n");
-    printf("  Ocupa as posicoes: (%d,%d), (%d,%d), (%d,%d)\n",
+    posicionarNavioBits(&tabuleiro, navio3_linha, navio3_coluna, navio3_orientacao);
+    mensagem("  Navio 3 posicionado com sucesso!\n");
+    mensagem("  Ocupa as posicoes: (%d,%d), (%d,%d), (%d,%d)\n",
            navio3_linha, navio3_coluna,
            navio3_linha + 1, navio3_coluna + 1,
            navio3_linha + 2, navio3_coluna + 2);
@@ -483,8 +506,8 @@ int main() {
     int navio4_coluna = 9;
     char navio4_orientacao = 'E';  // E = Diagonal baixo-esquerda (↙)
 
-    printf("\nPosicionando Navio 4 (Diagonal Baixo-Esquerda)...\n");
-    printf("  Posicao inicial: linha %d, coluna %d\n", navio4_linha, navio4_coluna);
+    mensagem("\nPosicionando Navio 4 (Diagonal Baixo-Esquerda)...\n");
+    mensagem("  Posicao inicial: linha %d, coluna %d\n", navio4_linha, navio4_coluna);
 
     // Validar se o navio cabe no tabuleiro
     if (!validarPosicao(navio4_linha, navio4_coluna, TAMANHO_NAVIO, navio4_orientacao)) {
@@ -493,100 +516,96 @@ int main() {
     }
 
     // Verificar se há sobreposição com navios já posicionados
-    if (verificarSobreposicao(tabuleiro, navio4_linha, navio4_coluna,
-                              TAMANHO_NAVIO, navio4_orientacao)) {
+    if (verificarSobreposicaoBits(&tabuleiro, navio4_linha, navio4_coluna,
+                                  TAMANHO_NAVIO, navio4_orientacao)) {
         printf("  ERRO: Sobreposicao detectada! Navio conflita com outro navio.\n");
         return 1;  // Encerra o programa com código de erro
     }
 
     // Posicionar o navio
-    posicionarNavio(tabuleiro, navio4_linha, navio4_coluna, navio4_orientacao);
-    printf("  Navio 4 posicionado com sucesso!\n");
-    printf("  Ocupa as posicoes: (%d,%d), (%d,%d), (%d,%d)\n",
+    posicionarNavioBits(&tabuleiro, navio4_linha, navio4_coluna, navio4_orientacao);
+    mensagem("  Navio 4 posicionado com sucesso!\n");
+    mensagem("  Ocupa as posicoes: (%d,%d), (%d,%d), (%d,%d)\n",
            navio4_linha, navio4_coluna,
            navio4_linha + 1, navio4_coluna - 1,
            navio4_linha + 2, navio4_coluna - 2);
 
     // ========== EXIBIÇÃO DO TABULEIRO COM NAVIOS ==========
 
-    printf("\n========================================\n");
-    printf("   TABULEIRO ORIGINAL COM NAVIOS\n");
-    printf("========================================\n");
-    exibirTabuleiro(tabuleiro);
+    mensagem("\n========================================\n");
+    mensagem("   TABULEIRO ORIGINAL COM NAVIOS\n");
+    mensagem("========================================\n");
+    exibirTabuleiroBits(&tabuleiro);
 
     // ========== DEMONSTRAÇÃO DE HABILIDADES ESPECIAIS ==========
 
-    printf("\n\n========================================\n");
-    printf("  DEMONSTRACAO DE HABILIDADES ESPECIAIS\n");
-    printf("========================================\n");
+    mensagem("\n\n========================================\n");
+    mensagem("  DEMONSTRACAO DE HABILIDADES ESPECIAIS\n");
+    mensagem("========================================\n");
+
+    // Cada prévia de habilidade é desfeita antes da seguinte
+    DeltaTabuleiro deltasPrevia[1];
+    HistoricoTabuleiro previa;
+    iniciarHistoricoTabuleiro(&previa, deltasPrevia, 1);
 
     // ========== HABILIDADE 1: CONE ==========
 
-    printf("\n--- Habilidade 1: CONE ---\n");
-    printf("Origem: linha 3, coluna 5\n");
-    printf("Efeito: Expande do topo para baixo em forma de cone\n\n");
+    mensagem("\n--- Habilidade 1: CONE ---\n");
+    mensagem("Origem: linha 3, coluna 5\n");
+    mensagem("Efeito: Expande do topo para baixo em forma de cone\n\n");
 
     // Criar matriz de habilidade Cone
     int matrizCone[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE];
     criarMatrizCone(matrizCone);
 
-    // Criar cópia do tabuleiro e aplicar cone
-    int tabuleiroCone[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
-    copiarTabuleiro(tabuleiro, tabuleiroCone);
-    aplicarHabilidade(tabuleiroCone, matrizCone, 3, 5);
-
-    // Exibir tabuleiro com cone
-    exibirTabuleiro(tabuleiroCone);
+    // Prévia: aplicar cone, exibir e desfazer (sem copiar o tabuleiro)
+    aplicarHabilidadeDesfazivel(&previa, &tabuleiro, matrizCone, 3, 5);
+    exibirTabuleiroBits(&tabuleiro);
+    voltarHistoricoTabuleiro(&previa, &tabuleiro, NULL, 0);
 
     // ========== HABILIDADE 2: CRUZ ==========
 
-    printf("\n--- Habilidade 2: CRUZ ---\n");
-    printf("Origem: linha 5, coluna 5\n");
-    printf("Efeito: Area em forma de cruz (+)\n\n");
+    mensagem("\n--- Habilidade 2: CRUZ ---\n");
+    mensagem("Origem: linha 5, coluna 5\n");
+    mensagem("Efeito: Area em forma de cruz (+)\n\n");
 
     // Criar matriz de habilidade Cruz
     int matrizCruz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE];
     criarMatrizCruz(matrizCruz);
 
-    // Criar cópia do tabuleiro e aplicar cruz
-    int tabuleiroCruz[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
-    copiarTabuleiro(tabuleiro, tabuleiroCruz);
-    aplicarHabilidade(tabuleiroCruz, matrizCruz, 5, 5);
-
-    // Exibir tabuleiro com cruz
-    exibirTabuleiro(tabuleiroCruz);
+    // Prévia: aplicar cruz, exibir e desfazer (sem copiar o tabuleiro)
+    aplicarHabilidadeDesfazivel(&previa, &tabuleiro, matrizCruz, 5, 5);
+    exibirTabuleiroBits(&tabuleiro);
+    voltarHistoricoTabuleiro(&previa, &tabuleiro, NULL, 0);
 
     // ========== HABILIDADE 3: OCTAEDRO ==========
 
-    printf("\n--- Habilidade 3: OCTAEDRO (LOSANGO) ---\n");
-    printf("Origem: linha 7, coluna 7\n");
-    printf("Efeito: Area em forma de losango/diamante (◇)\n\n");
+    mensagem("\n--- Habilidade 3: OCTAEDRO (LOSANGO) ---\n");
+    mensagem("Origem: linha 7, coluna 7\n");
+    mensagem("Efeito: Area em forma de losango/diamante (◇)\n\n");
 
     // Criar matriz de habilidade Octaedro
     int matrizOctaedro[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE];
     criarMatrizOctaedro(matrizOctaedro);
 
-    // Criar cópia do tabuleiro e aplicar octaedro
-    int tabuleiroOctaedro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
-    copiarTabuleiro(tabuleiro, tabuleiroOctaedro);
-    aplicarHabilidade(tabuleiroOctaedro, matrizOctaedro, 7, 7);
-
-    // Exibir tabuleiro com octaedro
-    exibirTabuleiro(tabuleiroOctaedro);
+    // Prévia: aplicar octaedro, exibir e desfazer (sem copiar o tabuleiro)
+    aplicarHabilidadeDesfazivel(&previa, &tabuleiro, matrizOctaedro, 7, 7);
+    exibirTabuleiroBits(&tabuleiro);
+    voltarHistoricoTabuleiro(&previa, &tabuleiro, NULL, 0);
 
     // ========== FINALIZAÇÃO ==========
 
-    printf("\n========================================\n");
-    printf("Programa executado com sucesso!\n");
-    printf("========================================\n");
-    printf("Total de navios posicionados: 4\n");
-    printf("  - 1 Horizontal\n");
-    printf("  - 1 Vertical\n");
-    printf("  - 2 Diagonais\n");
-    printf("\nHabilidades demonstradas: 3\n");
-    printf("  - Cone (expande para baixo)\n");
-    printf("  - Cruz (linha e coluna central)\n");
-    printf("  - Octaedro (formato losango)\n");
+    mensagem("\n========================================\n");
+    mensagem("Programa executado com sucesso!\n");
+    mensagem("========================================\n");
+    mensagem("Total de navios posicionados: 4\n");
+    mensagem("  - 1 Horizontal\n");
+    mensagem("  - 1 Vertical\n");
+    mensagem("  - 2 Diagonais\n");
+    mensagem("\nHabilidades demonstradas: 3\n");
+    mensagem("  - Cone (expande para baixo)\n");
+    mensagem("  - Cruz (linha e coluna central)\n");
+    mensagem("  - Octaedro (formato losango)\n");
 
     return 0;  // Encerra o programa com sucesso
 }
@@ -0,0 +1,587 @@
+/*
+ * Programa: Benchmark do Batalha Naval
+ * Descrição: Mede o custo das primitivas do tabuleiro (matriz tradicional e
+ *            motor em bits), da geração de frotas e de partidas completas,
+ *            em ns/op e ops/s, com falhas de cache via perf_event no Linux.
+ * Compilação: alvo "benchmark" do CMake (ligado à biblioteca estática)
+ * Uso: benchmark [segundos por caso] [filtro por nome]
+ */
+
+#include "batalha_naval_interno.h"
+
+#ifdef __linux__
+#include <unistd.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#define BENCHMARK_PERF_EVENT 1  // Contadores de hardware disponíveis neste sistema
+#endif
+
+#define SEMENTE_BENCHMARK 2026        // Semente fixa: toda execução mede a mesma carga
+#define TEMPO_CALIBRACAO 0.01         // Duração mínima da rodada de calibração (s)
+#define TEMPO_PADRAO_POR_CASO 0.5     // Duração alvo de cada caso (s)
+
+// Destino dos resultados: impede o compilador de eliminar o trabalho medido
+static volatile uint64_t sumidouro;
+
+// Tabuleiros de referência usados pelos casos (montados uma vez em prepararDados)
+static int tabuleiroFrota[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
+static TabuleiroBits tabuleiroFrotaBits;
+static int matrizConeBenchmark[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE];
+static GeradorAleatorio geradorBenchmark;
+
+/*
+ * Tipo: CasoBenchmark
+ * Campos:
+ *   - nome: identificação exibida no relatório e usada pelo filtro
+ *   - executar: executa a operação "iteracoes" vezes e devolve um valor
+ *               derivado dos resultados (vai para o sumidouro)
+ */
+typedef struct {
+    const char *nome;
+    uint64_t (*executar)(long long iteracoes);
+} CasoBenchmark;
+
+// ---------- Matriz tradicional ----------
+
+static uint64_t casoInicializarTabuleiro(long long iteracoes) {
+    int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        inicializarTabuleiro(tabuleiro);
+        soma += (uint64_t)tabuleiro[i % TAMANHO_TABULEIRO][0];
+    }
+    return soma;
+}
+
+static uint64_t casoValidarPosicao(long long iteracoes) {
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        int celula = (int)(i % CELULAS_TABULEIRO);
+        soma += (uint64_t)validarPosicao(celula / TAMANHO_TABULEIRO, celula % TAMANHO_TABULEIRO,
+                                         TAMANHO_NAVIO, ORIENTACOES[(i / CELULAS_TABULEIRO) % 4]);
+    }
+    return soma;
+}
+
+static uint64_t casoVerificarSobreposicao(long long iteracoes) {
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        const Posicionamento *p = &tabelaPosicionamentos[i % quantidadePosicionamentos];
+        soma += (uint64_t)verificarSobreposicao(tabuleiroFrota, p->linha, p->coluna,
+                                                TAMANHO_NAVIO, p->orientacao);
+    }
+    return soma;
+}
+
+static uint64_t casoPosicionarNavio(long long iteracoes) {
+    int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
+    uint64_t soma = 0;
+    inicializarTabuleiro(tabuleiro);
+    for (long long i = 0; i < iteracoes; i++) {
+        const Posicionamento *p = &tabelaPosicionamentos[i % quantidadePosicionamentos];
+        posicionarNavio(tabuleiro, p->linha, p->coluna, p->orientacao);
+        soma += (uint64_t)tabuleiro[p->linha][p->coluna];
+    }
+    return soma;
+}
+
+static uint64_t casoCopiarTabuleiro(long long iteracoes) {
+    int copia[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        copiarTabuleiro(tabuleiroFrota, copia);
+        soma += (uint64_t)copia[i % TAMANHO_TABULEIRO][i % TAMANHO_TABULEIRO];
+    }
+    return soma;
+}
+
+static uint64_t casoAplicarHabilidade(long long iteracoes) {
+    int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
+    uint64_t soma = 0;
+    copiarTabuleiro(tabuleiroFrota, tabuleiro);
+    for (long long i = 0; i < iteracoes; i++) {
+        int celula = (int)(i % CELULAS_TABULEIRO);
+        aplicarHabilidade(tabuleiro, matrizConeBenchmark, celula / TAMANHO_TABULEIRO,
+                          celula % TAMANHO_TABULEIRO);
+        soma += (uint64_t)tabuleiro[celula / TAMANHO_TABULEIRO][celula % TAMANHO_TABULEIRO];
+    }
+    return soma;
+}
+
+static uint64_t casoCriarMatrizCone(long long iteracoes) {
+    int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE];
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        criarMatrizCone(matriz);
+        soma += (uint64_t)matriz[i % TAMANHO_MATRIZ_HABILIDADE][3];
+    }
+    return soma;
+}
+
+static uint64_t casoCriarMatrizCruz(long long iteracoes) {
+    int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE];
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        criarMatrizCruz(matriz);
+        soma += (uint64_t)matriz[i % TAMANHO_MATRIZ_HABILIDADE][3];
+    }
+    return soma;
+}
+
+static uint64_t casoCriarMatrizOctaedro(long long iteracoes) {
+    int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE];
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        criarMatrizOctaedro(matriz);
+        soma += (uint64_t)matriz[i % TAMANHO_MATRIZ_HABILIDADE][3];
+    }
+    return soma;
+}
+
+// ---------- Motor em bits ----------
+
+static uint64_t casoVerificarSobreposicaoBits(long long iteracoes) {
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        const Posicionamento *p = &tabelaPosicionamentos[i % quantidadePosicionamentos];
+        soma += (uint64_t)verificarSobreposicaoBits(&tabuleiroFrotaBits, p->linha, p->coluna,
+                                                    TAMANHO_NAVIO, p->orientacao);
+    }
+    return soma;
+}
+
+static uint64_t casoAplicarFormaBits(long long iteracoes) {
+    const FormaHabilidade *cone = obterForma(FORMA_CONE, RAIO_CLASSICO);
+    TabuleiroBits tabuleiro = tabuleiroFrotaBits;
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        int celula = (int)(i % CELULAS_TABULEIRO);
+        aplicarFormaBits(&tabuleiro, cone, celula / TAMANHO_TABULEIRO, celula % TAMANHO_TABULEIRO);
+        soma += tabuleiro.habilidade.palavra[i & 1];
+    }
+    return soma;
+}
+
+static uint64_t casoFormatarTabuleiroBits(long long iteracoes) {
+    char buffer[TAMANHO_BUFFER_TABULEIRO];
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        soma += formatarTabuleiroBits(&tabuleiroFrotaBits, buffer);
+    }
+    return soma;
+}
+
+// ---------- Frotas e partidas ----------
+
+static uint64_t casoGerarFrotaRapida(long long iteracoes) {
+    Frota frota;
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        gerarFrota(&geradorBenchmark, FROTA_RAPIDA, &frota);
+        soma += frota.ocupacao.palavra[0];
+    }
+    return soma;
+}
+
+static uint64_t casoGerarFrotaUniforme(long long iteracoes) {
+    Frota frota;
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        gerarFrota(&geradorBenchmark, FROTA_UNIFORME, &frota);
+        soma += frota.ocupacao.palavra[0];
+    }
+    return soma;
+}
+
+static uint64_t casoPartidaCaca(long long iteracoes) {
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        soma += (uint64_t)jogarPartida(&geradorBenchmark, POLITICA_CACA, FROTA_UNIFORME);
+    }
+    return soma;
+}
+
+static uint64_t casoPartidaAleatoria(long long iteracoes) {
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        soma += (uint64_t)jogarPartida(&geradorBenchmark, POLITICA_ALEATORIA, FROTA_UNIFORME);
+    }
+    return soma;
+}
+
+// ---------- Solucionador exato e tabela de transposição ----------
+
+#define POSICOES_SOLUCIONADOR 16   // Posições de fim de jogo revisitadas em rodízio
+#define TIROS_SOLUCIONADOR 60      // Tiros de cada posição
+
+static Bitboard aguaSolucionador[POSICOES_SOLUCIONADOR];
+static Bitboard acertosSolucionador[POSICOES_SOLUCIONADOR];
+
+// Cada posição: TIROS_SOLUCIONADOR tiros sorteados contra a frota de referência
+static void prepararPosicoesSolucionador(void) {
+    GeradorAleatorio gerador;  // Separado: não altera a sequência dos outros casos
+    semearGerador(&gerador, SEMENTE_BENCHMARK + 1);
+    for (int p = 0; p < POSICOES_SOLUCIONADOR; p++) {
+        Bitboard tiros = bitboardVazio();
+        while (bitboardContarCelulas(tiros) < TIROS_SOLUCIONADOR) {
+            tiros = bitboardOu(tiros, bitboardCelula((int)aleatorioAte(&gerador, CELULAS_TABULEIRO)));
+        }
+        aguaSolucionador[p] = bitboardENao(tiros, tabuleiroFrotaBits.navios);
+        acertosSolucionador[p] = bitboardE(tiros, tabuleiroFrotaBits.navios);
+    }
+}
+
+static uint64_t casoSolucionador(long long iteracoes) {
+    static ResultadoSolucionador resultado;
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        int p = (int)(i % POSICOES_SOLUCIONADOR);
+        resolverConfiguracoes(aguaSolucionador[p], acertosSolucionador[p], &resultado);
+        soma += resultado.total;
+    }
+    return soma;
+}
+
+// As mesmas posições, que se repetem como transposições, resolvidas pelo cache
+static uint64_t casoSolucionadorCache(long long iteracoes) {
+    static ResultadoSolucionador resultado;
+    TabelaTransposicao *cache = criarTabelaTransposicao(64 * POSICOES_SOLUCIONADOR,
+                                                        PALAVRAS_RESULTADO_SOLUCIONADOR);
+    uint64_t soma = 0;
+    if (cache == NULL) {
+        return 0;
+    }
+    for (long long i = 0; i < iteracoes; i++) {
+        int p = (int)(i % POSICOES_SOLUCIONADOR);
+        resolverConfiguracoesEmCache(cache, aguaSolucionador[p], acertosSolucionador[p], &resultado);
+        soma += resultado.total;
+    }
+    destruirTabelaTransposicao(cache);
+    return soma;
+}
+
+// ---------- Partidas em tabuleiro dinâmico ----------
+
+#define LADO_PREVIA_DINAMICA 512  // Tabuleiro grande: a cópia custa 256 KB por prévia
+
+static TabuleiroDinamico tabuleiroPrevia;
+
+// Prévia de habilidade copiando o tabuleiro dinâmico a cada vez
+static uint64_t casoPreviaCopia(long long iteracoes) {
+    const FormaHabilidade *cone = obterForma(FORMA_CONE, RAIO_CLASSICO);
+    TabuleiroDinamico previa;
+    uint64_t soma = 0;
+    if (tabuleiroPrevia.celulas == NULL ||
+        criarTabuleiroDinamico(&previa, LADO_PREVIA_DINAMICA, LADO_PREVIA_DINAMICA) != 0) {
+        return 0;
+    }
+    for (long long i = 0; i < iteracoes; i++) {
+        int linha = (int)(i % LADO_PREVIA_DINAMICA);
+        memcpy(previa.celulas, tabuleiroPrevia.celulas,
+               (size_t)tabuleiroPrevia.passo * (size_t)tabuleiroPrevia.altura);
+        aplicarFormaDinamico(&previa, cone, linha, linha);
+        soma += *celulaDinamica(&previa, linha, linha);
+    }
+    liberarTabuleiroDinamico(&previa);
+    return soma;
+}
+
+// Prévia de habilidade aplicada no próprio tabuleiro e desfeita pelo histórico
+static uint64_t casoPreviaDesfazer(long long iteracoes) {
+    const FormaHabilidade *cone = obterForma(FORMA_CONE, RAIO_CLASSICO);
+    AlteracaoCelula alteracoes[TAMANHO_MATRIZ_HABILIDADE * TAMANHO_MATRIZ_HABILIDADE];
+    HistoricoDinamico historico;
+    uint64_t soma = 0;
+    if (tabuleiroPrevia.celulas == NULL) {
+        return 0;
+    }
+    iniciarHistoricoDinamico(&historico, alteracoes,
+                             sizeof(alteracoes) / sizeof(alteracoes[0]));
+    for (long long i = 0; i < iteracoes; i++) {
+        int linha = (int)(i % LADO_PREVIA_DINAMICA);
+        aplicarFormaDinamicoDesfazivel(&historico, &tabuleiroPrevia, cone, linha, linha);
+        soma += *celulaDinamica(&tabuleiroPrevia, linha, linha);
+        voltarHistoricoDinamico(&historico, &tabuleiroPrevia, 0);
+    }
+    return soma;
+}
+
+// Matriz 7x7 clássica carimbada em um tabuleiro dinâmico 10x10 com o kernel indicado;
+// o tabuleiro volta a ser água a cada volta completa pelas 100 origens
+static uint64_t medirHabilidadeDinamica(long long iteracoes, KernelHabilidade kernel) {
+    unsigned char celulas[TAMANHO_MATRIZ_HABILIDADE * TAMANHO_MATRIZ_HABILIDADE];
+    MatrizHabilidadeDinamica matriz = {TAMANHO_MATRIZ_HABILIDADE, celulas};
+    TabuleiroDinamico tabuleiro;
+    uint64_t soma = 0;
+    if (criarTabuleiroDinamico(&tabuleiro, TAMANHO_TABULEIRO, TAMANHO_TABULEIRO) != 0) {
+        return 0;
+    }
+    for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
+        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
+            celulas[i * TAMANHO_MATRIZ_HABILIDADE + j] = (unsigned char)matrizConeBenchmark[i][j];
+        }
+    }
+    for (long long i = 0; i < iteracoes; i++) {
+        int celula = (int)(i % CELULAS_TABULEIRO);
+        if (celula == 0) {
+            inicializarTabuleiroDinamico(&tabuleiro);
+        }
+        aplicarHabilidadeDinamicoComKernel(&tabuleiro, &matriz, celula / TAMANHO_TABULEIRO,
+                                           celula % TAMANHO_TABULEIRO, kernel);
+        soma += *celulaDinamica(&tabuleiro, celula / TAMANHO_TABULEIRO, celula % TAMANHO_TABULEIRO);
+    }
+    liberarTabuleiroDinamico(&tabuleiro);
+    return soma;
+}
+
+static uint64_t casoHabilidadeDinamicaEscalar(long long iteracoes) {
+    return medirHabilidadeDinamica(iteracoes, KERNEL_ESCALAR);
+}
+
+static uint64_t casoHabilidadeDinamicaVetorial(long long iteracoes) {
+    return medirHabilidadeDinamica(iteracoes, KERNEL_AUTOMATICO);
+}
+
+#define LADO_PARTIDA_DINAMICA 10  // Tabuleiro 10x10 com a frota clássica
+
+static EspecificacaoFrota frotaBenchmark;
+
+// Cada partida com uma arena própria: todo o estado passa por malloc e free
+static uint64_t casoPartidaDinamicaMalloc(long long iteracoes) {
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        Arena arena;
+        iniciarArena(&arena, 0);
+        soma += (uint64_t)jogarPartidaDinamica(&geradorBenchmark, &arena, LADO_PARTIDA_DINAMICA,
+                                               LADO_PARTIDA_DINAMICA, &frotaBenchmark);
+        liberarArena(&arena);
+    }
+    return soma;
+}
+
+// Todas as partidas na arena da thread: cada uma é descartada em O(1)
+static uint64_t casoPartidaDinamicaArena(long long iteracoes) {
+    Arena *arena = arenaDaThread();
+    uint64_t soma = 0;
+    for (long long i = 0; i < iteracoes; i++) {
+        soma += (uint64_t)jogarPartidaDinamica(&geradorBenchmark, arena, LADO_PARTIDA_DINAMICA,
+                                               LADO_PARTIDA_DINAMICA, &frotaBenchmark);
+    }
+    return soma;
+}
+
+static const CasoBenchmark CASOS[] = {
+    {"inicializarTabuleiro", casoInicializarTabuleiro},
+    {"validarPosicao", casoValidarPosicao},
+    {"verificarSobreposicao", casoVerificarSobreposicao},
+    {"posicionarNavio", casoPosicionarNavio},
+    {"copiarTabuleiro", casoCopiarTabuleiro},
+    {"aplicarHabilidade", casoAplicarHabilidade},
+    {"criarMatrizCone", casoCriarMatrizCone},
+    {"criarMatrizCruz", casoCriarMatrizCruz},
+    {"criarMatrizOctaedro", casoCriarMatrizOctaedro},
+    {"verificarSobreposicaoBits", casoVerificarSobreposicaoBits},
+    {"aplicarFormaBits", casoAplicarFormaBits},
+    {"formatarTabuleiroBits", casoFormatarTabuleiroBits},
+    {"carimbo 7x7 dinamico (escalar)", casoHabilidadeDinamicaEscalar},
+    {"carimbo 7x7 dinamico (vetorial)", casoHabilidadeDinamicaVetorial},
+    {"previa dinamica 512 (copia)", casoPreviaCopia},
+    {"previa dinamica 512 (desfazer)", casoPreviaDesfazer},
+    {"gerarFrota (rapida)", casoGerarFrotaRapida},
+    {"gerarFrota (uniforme)", casoGerarFrotaUniforme},
+    {"partida completa (caca)", casoPartidaCaca},
+    {"partida completa (aleatoria)", casoPartidaAleatoria},
+    {"solucionador fim de jogo", casoSolucionador},
+    {"solucionador fim de jogo (cache)", casoSolucionadorCache},
+    {"partida dinamica 10x10 (malloc)", casoPartidaDinamicaMalloc},
+    {"partida dinamica 10x10 (arena)", casoPartidaDinamicaArena},
+};
+
+// ---------- Contadores de cache ----------
+
+/*
+ * Tipo: ContadoresCache
+ * Propósito: Descritores perf_event de referências e falhas de cache (-1 = indisponível)
+ */
+typedef struct {
+    int referencias;
+    int falhas;
+} ContadoresCache;
+
+#ifdef BENCHMARK_PERF_EVENT
+// Abre um contador de hardware para este processo, apenas em modo usuário
+static int abrirContador(uint64_t evento) {
+    struct perf_event_attr atributos;
+    memset(&atributos, 0, sizeof(atributos));
+    atributos.type = PERF_TYPE_HARDWARE;
+    atributos.size = sizeof(atributos);
+    atributos.config = evento;
+    atributos.disabled = 1;
+    atributos.exclude_kernel = 1;  // Permitido mesmo com perf_event_paranoid = 2
+    atributos.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &atributos, 0, -1, -1, 0);
+}
+
+static long long lerContador(int descritor) {
+    long long valor = 0;
+    if (descritor < 0 || read(descritor, &valor, sizeof(valor)) != (ssize_t)sizeof(valor)) {
+        return -1;
+    }
+    return valor;
+}
+#endif
+
+static void abrirContadoresCache(ContadoresCache *contadores) {
+#ifdef BENCHMARK_PERF_EVENT
+    contadores->referencias = abrirContador(PERF_COUNT_HW_CACHE_REFERENCES);
+    contadores->falhas = abrirContador(PERF_COUNT_HW_CACHE_MISSES);
+#else
+    contadores->referencias = -1;
+    contadores->falhas = -1;
+#endif
+}
+
+static void iniciarContadoresCache(const ContadoresCache *contadores) {
+#ifdef BENCHMARK_PERF_EVENT
+    int descritores[2] = {contadores->referencias, contadores->falhas};
+    for (int k = 0; k < 2; k++) {
+        if (descritores[k] >= 0) {
+            ioctl(descritores[k], PERF_EVENT_IOC_RESET, 0);
+            ioctl(descritores[k], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#else
+    (void)contadores;
+#endif
+}
+
+// Para os contadores e lê os valores (-1 quando indisponíveis)
+static void pararContadoresCache(const ContadoresCache *contadores, long long *referencias,
+                                 long long *falhas) {
+#ifdef BENCHMARK_PERF_EVENT
+    int descritores[2] = {contadores->referencias, contadores->falhas};
+    for (int k = 0; k < 2; k++) {
+        if (descritores[k] >= 0) {
+            ioctl(descritores[k], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    *referencias = lerContador(contadores->referencias);
+    *falhas = lerContador(contadores->falhas);
+#else
+    (void)contadores;
+    *referencias = -1;
+    *falhas = -1;
+#endif
+}
+
+static void fecharContadoresCache(ContadoresCache *contadores) {
+#ifdef BENCHMARK_PERF_EVENT
+    if (contadores->referencias >= 0) close(contadores->referencias);
+    if (contadores->falhas >= 0) close(contadores->falhas);
+#endif
+    contadores->referencias = -1;
+    contadores->falhas = -1;
+}
+
+// ---------- Execução ----------
+
+// Monta a frota de referência (a mesma do programa principal) e as tabelas globais
+static void prepararDados(void) {
+    inicializarTabelaPosicionamentos();
+    semearGerador(&geradorBenchmark, SEMENTE_BENCHMARK);
+
+    inicializarTabuleiro(tabuleiroFrota);
+    posicionarNavio(tabuleiroFrota, 4, 1, 'H');
+    posicionarNavio(tabuleiroFrota, 5, 7, 'V');
+    posicionarNavio(tabuleiroFrota, 0, 0, 'D');
+    posicionarNavio(tabuleiroFrota, 0, 9, 'E');
+    compactarTabuleiro(tabuleiroFrota, &tabuleiroFrotaBits);
+    criarMatrizCone(matrizConeBenchmark);
+    prepararPosicoesSolucionador();
+    frotaBenchmark = especificacaoFrotaClassica();
+    if (criarTabuleiroDinamico(&tabuleiroPrevia, LADO_PREVIA_DINAMICA, LADO_PREVIA_DINAMICA) == 0) {
+        GeradorAleatorio geradorPrevia;  // Separado: não altera a sequência dos outros casos
+        semearGerador(&geradorPrevia, SEMENTE_BENCHMARK);
+        posicionarFrotaDinamica(&tabuleiroPrevia, &frotaBenchmark, &geradorPrevia);
+    }
+}
+
+/*
+ * Função: medirCaso
+ * Propósito: Calibra a quantidade de iterações e mede um caso
+ * Parâmetros:
+ *   - caso: caso a ser medido
+ *   - segundosAlvo: duração desejada da medição
+ *   - contadores: contadores de cache já abertos
+ * Retorno: void (não retorna valor); imprime uma linha do relatório
+ * Lógica: Dobra as iterações até a rodada durar TEMPO_CALIBRACAO (o que também
+ *         aquece caches e preditores), estima o custo por operação e então
+ *         executa uma única rodada medida com a duração alvo
+ */
+static void medirCaso(const CasoBenchmark *caso, double segundosAlvo,
+                      const ContadoresCache *contadores) {
+    long long iteracoes = 1;
+    double decorrido;
+
+    for (;;) {
+        double inicio = relogioSegundos();
+        sumidouro += caso->executar(iteracoes);
+        decorrido = relogioSegundos() - inicio;
+        if (decorrido >= TEMPO_CALIBRACAO) {
+            break;
+        }
+        iteracoes *= 2;
+    }
+    iteracoes = (long long)((double)iteracoes * segundosAlvo / decorrido) + 1;
+
+    long long referencias, falhas;
+    iniciarContadoresCache(contadores);
+    double inicio = relogioSegundos();
+    sumidouro += caso->executar(iteracoes);
+    decorrido = relogioSegundos() - inicio;
+    pararContadoresCache(contadores, &referencias, &falhas);
+
+    double nsPorOperacao = decorrido * 1e9 / (double)iteracoes;
+    printf("%-30s %12lld %12.2f %14.0f", caso->nome, iteracoes, nsPorOperacao,
+           (double)iteracoes / decorrido);
+    if (falhas >= 0 && referencias >= 0) {
+        printf(" %12.4f %12.4f\n", (double)referencias / (double)iteracoes,
+               (double)falhas / (double)iteracoes);
+    } else {
+        printf(" %12s %12s\n", "n/d", "n/d");
+    }
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[]) {
+    double segundosAlvo = argc > 1 ? atof(argv[1]) : TEMPO_PADRAO_POR_CASO;
+    const char *filtro = argc > 2 ? argv[2] : NULL;
+    ContadoresCache contadores;
+
+    if (segundosAlvo <= 0) {
+        printf("ERRO: Uso: benchmark [segundos por caso] [filtro por nome]\n");
+        return 1;
+    }
+
+    prepararDados();
+    abrirContadoresCache(&contadores);
+
+    printf("Semente: %d | Kernel de habilidade: %d | Contadores de cache: %s | Instrumentacao: %s\n",
+           SEMENTE_BENCHMARK, (int)obterKernelHabilidade(),
+           contadores.falhas >= 0 ? "perf_event" : "indisponiveis",
+           instrumentacaoAtiva() ? "ativa" : "desligada");
+    printf("%-30s %12s %12s %14s %12s %12s\n", "caso", "iteracoes", "ns/op", "ops/s",
+           "refs/op", "falhas/op");
+
+    for (size_t c = 0; c < sizeof(CASOS) / sizeof(CASOS[0]); c++) {
+        if (filtro == NULL || strstr(CASOS[c].nome, filtro) != NULL) {
+            medirCaso(&CASOS[c], segundosAlvo, &contadores);
+        }
+    }
+
+    fecharContadoresCache(&contadores);
+    liberarTabuleiroDinamico(&tabuleiroPrevia);
+    liberarArenaDaThread();
+    return 0;
+}
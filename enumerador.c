@@ -0,0 +1,134 @@
+/*
+ * Programa: Enumerador de layouts do Batalha Naval
+ * Descrição: Enumera todos os layouts legais da frota do programa principal
+ *            (quatro navios de TAMANHO_NAVIO posições, orientações 'H', 'V', 'D'
+ *            e 'E') em paralelo, exibe a frequência de navio em cada célula,
+ *            confere o resultado e grava a distribuição a priori usada para
+ *            semear a mira dos atiradores.
+ * Compilação: alvo "enumerador" do CMake (ligado à biblioteca estática)
+ * Uso: enumerador [threads] [arquivo da priori]
+ */
+
+#include "batalha_naval_interno.h"
+
+#define AMOSTRAS_NUMERACAO 4096  // Layouts conferidos com as funções da matriz tradicional
+
+/*
+ * Função: conferirLayout
+ * Propósito: Monta um layout na matriz tradicional, com validarPosicao e
+ *            verificarSobreposicao, e confere se a sua numeração é reversível
+ * Parâmetros:
+ *   - enumeracao: enumeração concluída
+ *   - posicao: número do layout
+ * Retorno: 1 se o layout é legal e posicaoLayout devolve a mesma posição, 0 caso contrário
+ */
+static int conferirLayout(const EnumeracaoLayouts *enumeracao, uint64_t posicao) {
+    int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
+    short navios[NAVIOS_LAYOUT];
+
+    if (layoutNaPosicao(enumeracao, posicao, navios) != 0) {
+        return 0;
+    }
+    inicializarTabuleiro(tabuleiro);
+    for (int n = 0; n < NAVIOS_LAYOUT; n++) {
+        const Posicionamento *p = &tabelaPosicionamentos[navios[n]];
+        if (n > 0 && navios[n] <= navios[n - 1]) {
+            return 0;  // Fora da ordem crescente: o mesmo layout teria outra posição
+        }
+        if (!validarPosicao(p->linha, p->coluna, TAMANHO_NAVIO, p->orientacao) ||
+            verificarSobreposicao(tabuleiro, p->linha, p->coluna, TAMANHO_NAVIO, p->orientacao)) {
+            return 0;
+        }
+        posicionarNavio(tabuleiro, p->linha, p->coluna, p->orientacao);
+    }
+    return posicaoLayout(enumeracao, navios) == posicao;
+}
+
+/*
+ * Função: exibirFrequencias
+ * Propósito: Mostra, para cada célula, a fração dos layouts que têm navio nela
+ * Parâmetros:
+ *   - enumeracao: enumeração concluída
+ * Retorno: void (não retorna valor)
+ */
+static void exibirFrequencias(const EnumeracaoLayouts *enumeracao) {
+    printf("\nFrequencia de navio por celula:\n\n     ");
+    for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+        printf("%6d", j);
+    }
+    printf("\n");
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        printf("%2d   ", i);
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            printf("%6.3f", (double)enumeracao->frequencia[INDICE_CELULA(i, j)] /
+                                (double)enumeracao->total);
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int threads = argc > 1 ? atoi(argv[1]) : 0;
+    const char *caminhoPriori = argc > 2 ? argv[2] : NULL;
+    EnumeracaoLayouts enumeracao;
+    ResultadoSolucionador priori, solucionador;
+    uint64_t amostras;
+    int falhas = 0;
+    double inicio, decorrido;
+
+    if (threads < 0) {
+        printf("ERRO: Uso: enumerador [threads] [arquivo da priori]\n");
+        return 1;
+    }
+
+    inicio = relogioSegundos();
+    if (enumerarLayouts(&enumeracao, threads) != 0) {
+        printf("ERRO: Nao foi possivel enumerar os layouts (memoria ou threads).\n");
+        return 1;
+    }
+    decorrido = relogioSegundos() - inicio;
+
+    printf("Layouts legais da frota (%d navios de %d posicoes): %llu\n", NAVIOS_LAYOUT,
+           TAMANHO_NAVIO, (unsigned long long)enumeracao.total);
+    printf("Tempo: %.3f s | Threads: %d | Tarefas roubadas: %lld\n", decorrido,
+           threads > 0 ? threads : contarNucleos(), enumeracao.roubos);
+    exibirFrequencias(&enumeracao);
+
+    // O solucionador exato chega ao mesmo resultado por outro caminho (memoização)
+    prioriDaEnumeracao(&enumeracao, &priori);
+    if (resolverConfiguracoes(bitboardVazio(), bitboardVazio(), &solucionador) != 0 ||
+        solucionador.total != priori.total ||
+        memcmp(solucionador.cobertura, priori.cobertura, sizeof(priori.cobertura)) != 0) {
+        printf("ERRO: A enumeracao difere do solucionador exato.\n");
+        falhas++;
+    } else {
+        printf("\nConferencia com o solucionador exato: OK\n");
+    }
+
+    // Amostras espalhadas por toda a numeração, incluindo o primeiro e o último layout
+    amostras = enumeracao.total < AMOSTRAS_NUMERACAO ? enumeracao.total : AMOSTRAS_NUMERACAO;
+    for (uint64_t a = 0; a < amostras; a++) {
+        uint64_t posicao = amostras > 1 ? a * (enumeracao.total - 1) / (amostras - 1) : 0;
+        if (!conferirLayout(&enumeracao, posicao)) {
+            printf("ERRO: Layout %llu invalido ou com numeracao inconsistente.\n",
+                   (unsigned long long)posicao);
+            falhas++;
+            break;
+        }
+    }
+    if (falhas == 0) {
+        printf("Conferencia da numeracao (%llu layouts): OK\n", (unsigned long long)amostras);
+    }
+
+    if (caminhoPriori != NULL && falhas == 0) {
+        if (gravarPriori(caminhoPriori, &priori) != 0) {
+            printf("ERRO: Nao foi possivel gravar %s.\n", caminhoPriori);
+            falhas++;
+        } else {
+            printf("Priori gravada em %s\n", caminhoPriori);
+        }
+    }
+
+    liberarEnumeracaoLayouts(&enumeracao);
+    return falhas ? 1 : 0;
+}
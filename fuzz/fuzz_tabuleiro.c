@@ -0,0 +1,506 @@
+/*
+ * Programa: Teste diferencial do tabuleiro (fuzz)
+ * Descrição: Interpreta bytes arbitrários como uma sequência de posicionamentos de
+ *            navios e de habilidades, executa cada operação nas funções originais
+ *            (fuzz/referencia.c) e em todos os caminhos rápidos do motor, e aborta
+ *            na primeira divergência entre os tabuleiros.
+ * Compilação: alvo "fuzz_tabuleiro" do CMake. Com BATALHA_NAVAL_LIBFUZZER=ON
+ *             (Clang), o alvo é ligado ao libFuzzer; sem ela, o main abaixo gera
+ *             as entradas ou as lê de arquivos.
+ * Uso: fuzz_tabuleiro [casos [semente]]  |  fuzz_tabuleiro arquivo...
+ */
+
+#include "referencia.h"
+
+// ========== CAMINHOS COMPARADOS ==========
+
+#define MAX_OPERACOES_FUZZ 256  // Operações interpretadas por entrada
+#define MAX_EFEITOS_LOTE 8      // Habilidades acumuladas antes de resolver o lote
+#define CASOS_PADRAO 100000     // Entradas geradas pelo main autônomo
+#define SEMENTE_PADRAO 2026
+#define TAMANHO_MAXIMO_GERADO 512  // Bytes de cada entrada gerada pelo main autônomo
+
+// Orientações sorteadas: as quatro válidas, em maiúsculas e minúsculas, e uma inválida
+static const char ORIENTACOES_FUZZ[] = "HVDEhvdeX";
+
+// Tabuleiros em bits, cada um alterado por um caminho diferente
+typedef enum {
+    BITS_MATRIZ,     // posicionarNavioBits e aplicarHabilidadeBits
+    BITS_FORMA,      // aplicarFormaBits com a forma equivalente à matriz
+    BITS_LOTE,       // aplicarEfeitosBits, em lotes de até MAX_EFEITOS_LOTE habilidades
+    BITS_HISTORICO,  // funções desfazíveis (o histórico é desfeito no fim da entrada)
+    QUANTIDADE_CAMINHOS_BITS
+} CaminhoBits;
+
+// Tabuleiros dinâmicos 10x10, cada um alterado por um caminho diferente
+typedef enum {
+    DINAMICO_ESCALAR,    // aplicarHabilidadeDinamicoComKernel com cada kernel
+    DINAMICO_SSE2,
+    DINAMICO_AVX2,
+    DINAMICO_FORMA,      // aplicarFormaDinamico
+    DINAMICO_LOTE,       // aplicarEfeitosDinamico
+    DINAMICO_HISTORICO,  // funções desfazíveis
+    QUANTIDADE_CAMINHOS_DINAMICOS
+} CaminhoDinamico;
+
+static const char *const NOMES_BITS[QUANTIDADE_CAMINHOS_BITS] = {
+    "bits (matriz)", "bits (forma)", "bits (lote)", "bits (historico)"
+};
+static const char *const NOMES_DINAMICOS[QUANTIDADE_CAMINHOS_DINAMICOS] = {
+    "dinamico (escalar)", "dinamico (SSE2)", "dinamico (AVX2)",
+    "dinamico (forma)", "dinamico (lote)", "dinamico (historico)"
+};
+static const KernelHabilidade KERNELS_DINAMICOS[3] = {KERNEL_ESCALAR, KERNEL_SSE2, KERNEL_AVX2};
+
+/*
+ * Tipo: EstadoFuzz
+ * Propósito: Todos os tabuleiros de uma entrada, mantidos em passo
+ * Campos:
+ *   - referencia: matriz alterada apenas pelas funções originais
+ *   - atual: matriz alterada pelas funções de mesmo nome da biblioteca
+ *   - bits, dinamicos: um tabuleiro por caminho rápido
+ *   - historico, deltas: histórico do tabuleiro BITS_HISTORICO
+ *   - historicoDinamico, alteracoes: histórico do tabuleiro DINAMICO_HISTORICO
+ *   - formasLote, efeitosLote, quantidadeLote: habilidades ainda não resolvidas
+ *     pelos caminhos em lote
+ *   - operacao: número da operação em andamento (para as mensagens)
+ */
+typedef struct {
+    int referencia[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
+    int atual[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
+    TabuleiroBits bits[QUANTIDADE_CAMINHOS_BITS];
+    TabuleiroDinamico dinamicos[QUANTIDADE_CAMINHOS_DINAMICOS];
+    HistoricoTabuleiro historico;
+    DeltaTabuleiro deltas[MAX_OPERACOES_FUZZ];
+    HistoricoDinamico historicoDinamico;
+    AlteracaoCelula alteracoes[MAX_OPERACOES_FUZZ * TAMANHO_MATRIZ_HABILIDADE *
+                               TAMANHO_MATRIZ_HABILIDADE];
+    FormaHabilidade formasLote[MAX_EFEITOS_LOTE];
+    EfeitoHabilidade efeitosLote[MAX_EFEITOS_LOTE];
+    int quantidadeLote;
+    int operacao;
+} EstadoFuzz;
+
+// Cursor sobre os bytes da entrada; depois do fim, lê zeros
+typedef struct {
+    const uint8_t *dados;
+    size_t tamanho;
+    size_t posicao;
+} LeitorBytes;
+
+static uint8_t lerByte(LeitorBytes *leitor) {
+    return leitor->posicao < leitor->tamanho ? leitor->dados[leitor->posicao++] : 0;
+}
+
+// Relata a divergência e aborta (o libFuzzer guarda a entrada que a provocou)
+static void divergencia(const EstadoFuzz *estado, const char *caminho, const char *detalhe) {
+    printf("ERRO: Divergencia em %s na operacao %d: %s\n", caminho, estado->operacao, detalhe);
+    fflush(stdout);
+    abort();
+}
+
+// Compara uma matriz com a referência, célula por célula
+static void conferirMatriz(const EstadoFuzz *estado, const char *caminho,
+                           int matriz[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]) {
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            if (matriz[i][j] != estado->referencia[i][j]) {
+                char detalhe[96];
+                snprintf(detalhe, sizeof(detalhe), "celula (%d, %d) = %d, referencia = %d",
+                         i, j, matriz[i][j], estado->referencia[i][j]);
+                divergencia(estado, caminho, detalhe);
+            }
+        }
+    }
+}
+
+// Compara um tabuleiro em bits com a referência, inclusive o hash mantido
+static void conferirBits(const EstadoFuzz *estado, const char *caminho,
+                         const TabuleiroBits *tabuleiro) {
+    int matriz[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO];
+
+    if (tabuleiro->hash != hashTabuleiroBits(tabuleiro)) {
+        divergencia(estado, caminho, "hash de Zobrist desatualizado");
+    }
+    if (bitboardTemInterseccao(tabuleiro->navios, tabuleiro->habilidade)) {
+        divergencia(estado, caminho, "camadas de navios e habilidade se sobrepoem");
+    }
+    expandirTabuleiro(tabuleiro, matriz);
+    conferirMatriz(estado, caminho, matriz);
+}
+
+static void conferirDinamico(const EstadoFuzz *estado, const char *caminho,
+                             const TabuleiroDinamico *tabuleiro) {
+    TabuleiroBits compacto;
+    if (compactarTabuleiroDinamico(tabuleiro, &compacto) != 0) {
+        divergencia(estado, caminho, "valor de celula invalido");
+    }
+    conferirBits(estado, caminho, &compacto);
+}
+
+// Compara todos os caminhos que não acumulam operações
+static void conferirTodos(EstadoFuzz *estado) {
+    conferirMatriz(estado, "matriz atual", estado->atual);
+    for (int b = 0; b < QUANTIDADE_CAMINHOS_BITS; b++) {
+        if (b != BITS_LOTE) {
+            conferirBits(estado, NOMES_BITS[b], &estado->bits[b]);
+        }
+    }
+    for (int d = 0; d < QUANTIDADE_CAMINHOS_DINAMICOS; d++) {
+        if (d != DINAMICO_LOTE) {
+            conferirDinamico(estado, NOMES_DINAMICOS[d], &estado->dinamicos[d]);
+        }
+    }
+}
+
+// Resolve as habilidades acumuladas nos caminhos em lote e confere os dois
+static void resolverLote(EstadoFuzz *estado) {
+    aplicarEfeitosBits(&estado->bits[BITS_LOTE], estado->efeitosLote, estado->quantidadeLote, NULL);
+    aplicarEfeitosDinamico(&estado->dinamicos[DINAMICO_LOTE], estado->efeitosLote,
+                           estado->quantidadeLote, NULL);
+    estado->quantidadeLote = 0;
+    conferirBits(estado, NOMES_BITS[BITS_LOTE], &estado->bits[BITS_LOTE]);
+    conferirDinamico(estado, NOMES_DINAMICOS[DINAMICO_LOTE], &estado->dinamicos[DINAMICO_LOTE]);
+}
+
+// Confere se dois resultados de verificação concordam com o da referência
+static void conferirResposta(const EstadoFuzz *estado, const char *caminho, int obtida,
+                             int esperada, const char *pergunta) {
+    if (obtida != esperada) {
+        char detalhe[96];
+        snprintf(detalhe, sizeof(detalhe), "%s = %d, referencia = %d", pergunta, obtida, esperada);
+        divergencia(estado, caminho, detalhe);
+    }
+}
+
+/*
+ * Função: operarNavio
+ * Propósito: Valida, verifica e (se possível) posiciona um navio em todos os caminhos
+ * Parâmetros:
+ *   - estado: tabuleiros da entrada
+ *   - leitor: bytes da linha, coluna, orientação e tamanho
+ * Retorno: void (não retorna valor)
+ */
+static void operarNavio(EstadoFuzz *estado, LeitorBytes *leitor) {
+    int linha = lerByte(leitor) % (TAMANHO_TABULEIRO + 2) - 1;
+    int coluna = lerByte(leitor) % (TAMANHO_TABULEIRO + 2) - 1;
+    char orientacao = ORIENTACOES_FUZZ[lerByte(leitor) % (sizeof(ORIENTACOES_FUZZ) - 1)];
+    int tamanho = 1 + lerByte(leitor) % 5;
+    const Posicionamento *p = tamanho == TAMANHO_NAVIO
+                                  ? consultarPosicionamento(linha, coluna, orientacao)
+                                  : NULL;
+    int valida = validarPosicaoOriginal(linha, coluna, tamanho, orientacao);
+    int ocupada;
+
+    // A sobreposição depende das habilidades ainda no lote
+    if (estado->quantidadeLote > 0) {
+        resolverLote(estado);
+    }
+
+    conferirResposta(estado, "validarPosicao", validarPosicao(linha, coluna, tamanho, orientacao),
+                     valida, "valida");
+    conferirResposta(estado, "validarPosicaoDinamico",
+                     validarPosicaoDinamico(&estado->dinamicos[DINAMICO_ESCALAR], linha, coluna,
+                                            tamanho, orientacao),
+                     valida, "valida");
+    if (tamanho == TAMANHO_NAVIO) {
+        conferirResposta(estado, "consultarPosicionamento", p != NULL, valida, "encontrado");
+    }
+    if (!valida) {
+        return;  // As demais funções exigem uma posição já validada
+    }
+
+    ocupada = verificarSobreposicaoOriginal(estado->referencia, linha, coluna, tamanho, orientacao);
+    conferirResposta(estado, "verificarSobreposicao",
+                     verificarSobreposicao(estado->atual, linha, coluna, tamanho, orientacao),
+                     ocupada, "sobreposicao");
+    for (int b = 0; b < QUANTIDADE_CAMINHOS_BITS; b++) {
+        conferirResposta(estado, NOMES_BITS[b],
+                         verificarSobreposicaoBits(&estado->bits[b], linha, coluna, tamanho,
+                                                   orientacao),
+                         ocupada, "sobreposicao");
+        if (p != NULL) {
+            conferirResposta(estado, NOMES_BITS[b], !posicionamentoLivre(&estado->bits[b], p),
+                             ocupada, "posicionamento ocupado");
+        }
+    }
+    for (int d = 0; d < QUANTIDADE_CAMINHOS_DINAMICOS; d++) {
+        conferirResposta(estado, NOMES_DINAMICOS[d],
+                         verificarSobreposicaoDinamico(&estado->dinamicos[d], linha, coluna,
+                                                       tamanho, orientacao),
+                         ocupada, "sobreposicao");
+    }
+    if (ocupada || p == NULL) {
+        return;  // As funções de posicionamento usam sempre TAMANHO_NAVIO
+    }
+
+    posicionarNavioOriginal(estado->referencia, linha, coluna, orientacao);
+    posicionarNavio(estado->atual, linha, coluna, orientacao);
+    for (int b = 0; b < QUANTIDADE_CAMINHOS_BITS; b++) {
+        if (b == BITS_HISTORICO) {
+            if (posicionarNavioDesfazivel(&estado->historico, &estado->bits[b], NULL, p) != 0) {
+                divergencia(estado, NOMES_BITS[b], "historico cheio");
+            }
+        } else {
+            posicionarNavioBits(&estado->bits[b], linha, coluna, orientacao);
+        }
+    }
+    for (int d = 0; d < QUANTIDADE_CAMINHOS_DINAMICOS; d++) {
+        if (d == DINAMICO_HISTORICO) {
+            if (posicionarNavioDinamicoDesfazivel(&estado->historicoDinamico, &estado->dinamicos[d],
+                                                  linha, coluna, tamanho, orientacao) != 0) {
+                divergencia(estado, NOMES_DINAMICOS[d], "historico cheio");
+            }
+        } else {
+            posicionarNavioDinamico(&estado->dinamicos[d], linha, coluna, tamanho, orientacao);
+        }
+    }
+}
+
+/*
+ * Função: operarHabilidade
+ * Propósito: Aplica uma habilidade clássica ou uma matriz arbitrária em todos os caminhos
+ * Parâmetros:
+ *   - estado: tabuleiros da entrada
+ *   - leitor: bytes do formato, da origem e, para matrizes arbitrárias, das 7 linhas
+ * Retorno: void (não retorna valor)
+ */
+static void operarHabilidade(EstadoFuzz *estado, LeitorBytes *leitor) {
+    int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE];
+    unsigned char celulas[TAMANHO_MATRIZ_HABILIDADE * TAMANHO_MATRIZ_HABILIDADE];
+    MatrizHabilidadeDinamica matrizDinamica = {TAMANHO_MATRIZ_HABILIDADE, celulas};
+    FormaHabilidade *forma = &estado->formasLote[estado->quantidadeLote];
+    const FormaHabilidade *registrada = NULL;
+    int formato = lerByte(leitor) % 4;
+    int linha = lerByte(leitor) % (TAMANHO_TABULEIRO + 8) - 4;  // A área pode sair do tabuleiro
+    int coluna = lerByte(leitor) % (TAMANHO_TABULEIRO + 8) - 4;
+
+    switch (formato) {
+        case 0:
+            criarMatrizConeOriginal(matriz);
+            registrada = obterForma(FORMA_CONE, RAIO_CLASSICO);
+            break;
+        case 1:
+            criarMatrizCruzOriginal(matriz);
+            registrada = obterForma(FORMA_CRUZ, RAIO_CLASSICO);
+            break;
+        case 2:
+            criarMatrizOctaedroOriginal(matriz);
+            registrada = obterForma(FORMA_OCTAEDRO, RAIO_CLASSICO);
+            break;
+        default:
+            for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
+                uint8_t bits = lerByte(leitor);
+                for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
+                    matriz[i][j] = (bits >> j) & 1;
+                }
+            }
+            break;
+    }
+
+    // A mesma área nos formatos usados pelos outros caminhos
+    forma->tipo = FORMA_CONE;  // Indiferente: só raio, tamanho e linhas são usados
+    forma->raio = RAIO_CLASSICO;
+    forma->tamanho = TAMANHO_MATRIZ_HABILIDADE;
+    forma->celulas = 0;
+    for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
+        forma->linhas[i] = 0;
+        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
+            celulas[i * TAMANHO_MATRIZ_HABILIDADE + j] = (unsigned char)matriz[i][j];
+            forma->linhas[i] |= (uint64_t)(matriz[i][j] == 1) << j;
+        }
+        forma->celulas += __builtin_popcountll(forma->linhas[i]);
+    }
+    if (registrada != NULL) {
+        for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
+            if (registrada->linhas[i] != forma->linhas[i]) {
+                divergencia(estado, "obterForma", "forma classica difere da matriz original");
+            }
+        }
+    }
+
+    aplicarHabilidadeOriginal(estado->referencia, matriz, linha, coluna);
+    aplicarHabilidade(estado->atual, matriz, linha, coluna);
+    aplicarHabilidadeBits(&estado->bits[BITS_MATRIZ], matriz, linha, coluna);
+    aplicarFormaBits(&estado->bits[BITS_FORMA], forma, linha, coluna);
+    if (aplicarHabilidadeDesfazivel(&estado->historico, &estado->bits[BITS_HISTORICO], matriz,
+                                    linha, coluna) != 0) {
+        divergencia(estado, NOMES_BITS[BITS_HISTORICO], "historico cheio");
+    }
+    for (int k = 0; k < 3; k++) {
+        aplicarHabilidadeDinamicoComKernel(&estado->dinamicos[DINAMICO_ESCALAR + k], &matrizDinamica,
+                                           linha, coluna, KERNELS_DINAMICOS[k]);
+    }
+    aplicarFormaDinamico(&estado->dinamicos[DINAMICO_FORMA], forma, linha, coluna);
+    if (aplicarFormaDinamicoDesfazivel(&estado->historicoDinamico,
+                                       &estado->dinamicos[DINAMICO_HISTORICO], forma,
+                                       linha, coluna) != 0) {
+        divergencia(estado, NOMES_DINAMICOS[DINAMICO_HISTORICO], "historico cheio");
+    }
+
+    estado->efeitosLote[estado->quantidadeLote].forma = forma;
+    estado->efeitosLote[estado->quantidadeLote].linha = linha;
+    estado->efeitosLote[estado->quantidadeLote].coluna = coluna;
+    if (++estado->quantidadeLote == MAX_EFEITOS_LOTE) {
+        resolverLote(estado);
+    }
+}
+
+/*
+ * Função: executarEntrada
+ * Propósito: Executa uma entrada do fuzz do início ao fim
+ * Parâmetros:
+ *   - dados, tamanho: bytes da entrada
+ * Retorno: void (aborta o programa na primeira divergência)
+ * Lógica: Cada operação começa com um byte: par posiciona um navio, ímpar aplica
+ *         uma habilidade. No fim, os lotes pendentes são resolvidos e os dois
+ *         históricos são desfeitos por inteiro, o que deve devolver tabuleiros vazios.
+ */
+static void executarEntrada(const uint8_t *dados, size_t tamanho) {
+    static EstadoFuzz estado;
+    static int dinamicosCriados = 0;
+    LeitorBytes leitor = {dados, tamanho, 0};
+    TabuleiroBits vazio;
+
+    if (!dinamicosCriados) {
+        for (int d = 0; d < QUANTIDADE_CAMINHOS_DINAMICOS; d++) {
+            if (criarTabuleiroDinamico(&estado.dinamicos[d], TAMANHO_TABULEIRO,
+                                       TAMANHO_TABULEIRO) != 0) {
+                printf("ERRO: Memoria insuficiente para os tabuleiros dinamicos.\n");
+                abort();
+            }
+        }
+        dinamicosCriados = 1;
+    }
+
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            estado.referencia[i][j] = AGUA;
+        }
+    }
+    inicializarTabuleiro(estado.atual);
+    for (int b = 0; b < QUANTIDADE_CAMINHOS_BITS; b++) {
+        inicializarTabuleiroBits(&estado.bits[b]);
+    }
+    for (int d = 0; d < QUANTIDADE_CAMINHOS_DINAMICOS; d++) {
+        inicializarTabuleiroDinamico(&estado.dinamicos[d]);
+    }
+    iniciarHistoricoTabuleiro(&estado.historico, estado.deltas, MAX_OPERACOES_FUZZ);
+    iniciarHistoricoDinamico(&estado.historicoDinamico, estado.alteracoes,
+                             sizeof(estado.alteracoes) / sizeof(estado.alteracoes[0]));
+    estado.quantidadeLote = 0;
+
+    for (estado.operacao = 0; estado.operacao < MAX_OPERACOES_FUZZ &&
+                              leitor.posicao < leitor.tamanho;
+         estado.operacao++) {
+        if (lerByte(&leitor) % 2 == 0) {
+            operarNavio(&estado, &leitor);
+        } else {
+            operarHabilidade(&estado, &leitor);
+        }
+        conferirTodos(&estado);
+    }
+    if (estado.quantidadeLote > 0) {
+        resolverLote(&estado);
+    }
+
+    // Desfazer tudo deve devolver os tabuleiros vazios
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            estado.referencia[i][j] = AGUA;
+        }
+    }
+    voltarHistoricoTabuleiro(&estado.historico, &estado.bits[BITS_HISTORICO], NULL, 0);
+    voltarHistoricoDinamico(&estado.historicoDinamico, &estado.dinamicos[DINAMICO_HISTORICO], 0);
+    inicializarTabuleiroBits(&vazio);
+    if (estado.bits[BITS_HISTORICO].hash != vazio.hash) {
+        divergencia(&estado, NOMES_BITS[BITS_HISTORICO], "hash nao voltou ao do tabuleiro vazio");
+    }
+    conferirBits(&estado, NOMES_BITS[BITS_HISTORICO], &estado.bits[BITS_HISTORICO]);
+    conferirDinamico(&estado, NOMES_DINAMICOS[DINAMICO_HISTORICO],
+                     &estado.dinamicos[DINAMICO_HISTORICO]);
+}
+
+// ========== PONTOS DE ENTRADA ==========
+
+// Chamado pelo libFuzzer para cada entrada
+int LLVMFuzzerTestOneInput(const uint8_t *dados, size_t tamanho);
+int LLVMFuzzerTestOneInput(const uint8_t *dados, size_t tamanho) {
+    executarEntrada(dados, tamanho);
+    return 0;
+}
+
+#ifndef BATALHA_NAVAL_LIBFUZZER
+
+// Executa um arquivo como entrada (corpus do libFuzzer ou caso reduzido)
+static int executarArquivo(const char *caminho) {
+    FILE *arquivo = fopen(caminho, "rb");
+    uint8_t *dados;
+    long tamanho;
+
+    if (arquivo == NULL || fseek(arquivo, 0, SEEK_END) != 0 || (tamanho = ftell(arquivo)) < 0) {
+        printf("ERRO: Nao foi possivel ler %s.\n", caminho);
+        if (arquivo != NULL) {
+            fclose(arquivo);
+        }
+        return -1;
+    }
+    rewind(arquivo);
+    dados = malloc(tamanho > 0 ? (size_t)tamanho : 1);
+    if (dados == NULL || fread(dados, 1, (size_t)tamanho, arquivo) != (size_t)tamanho) {
+        printf("ERRO: Nao foi possivel ler %s.\n", caminho);
+        free(dados);
+        fclose(arquivo);
+        return -1;
+    }
+    fclose(arquivo);
+    executarEntrada(dados, (size_t)tamanho);
+    free(dados);
+    return 0;
+}
+
+// Retorna 1 se o texto for um número decimal sem sinal
+static int ehNumero(const char *texto) {
+    if (*texto == '\0') {
+        return 0;
+    }
+    for (; *texto; texto++) {
+        if (*texto < '0' || *texto > '9') {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    uint8_t dados[TAMANHO_MAXIMO_GERADO];
+    GeradorAleatorio gerador;
+    unsigned long long casos = CASOS_PADRAO;
+    uint64_t semente = SEMENTE_PADRAO;
+
+    if (argc > 1 && !ehNumero(argv[1])) {
+        for (int a = 1; a < argc; a++) {
+            if (executarArquivo(argv[a]) != 0) {
+                return 1;
+            }
+        }
+        printf("Arquivos executados: %d | Divergencias: 0\n", argc - 1);
+        return 0;
+    }
+
+    if (argc > 1) casos = strtoull(argv[1], NULL, 10);
+    if (argc > 2) semente = strtoull(argv[2], NULL, 10);
+    semearGerador(&gerador, semente);
+    for (unsigned long long c = 0; c < casos; c++) {
+        size_t tamanho = aleatorioAte(&gerador, TAMANHO_MAXIMO_GERADO + 1);
+        for (size_t i = 0; i < tamanho; i++) {
+            dados[i] = (uint8_t)proximoAleatorio(&gerador);
+        }
+        executarEntrada(dados, tamanho);
+    }
+    printf("Casos executados: %llu | Semente: %llu | Kernel de habilidade: %d | Divergencias: 0\n",
+           casos, (unsigned long long)semente, (int)obterKernelHabilidade());
+    return 0;
+}
+
+#endif  // BATALHA_NAVAL_LIBFUZZER
@@ -0,0 +1,288 @@
+/*
+ * Arquivo: fuzz/referencia.c
+ * Descrição: Cópia fiel das funções do tabuleiro na versão original do programa
+ *            (matriz int[10][10], antes do motor em bits), usada como referência
+ *            pelo teste diferencial. Só os nomes ganharam o sufixo "Original".
+ * Nota: Não otimizar nem corrigir este arquivo: qualquer mudança de comportamento
+ *       aqui esconde justamente as divergências que o teste procura.
+ */
+
+#include "referencia.h"
+
+/*
+ * Função: validarPosicaoOriginal
+ * Propósito: Verifica se um navio cabe dentro dos limites do tabuleiro
+ * Parâmetros:
+ *   - linha: linha inicial do navio
+ *   - coluna: coluna inicial do navio
+ *   - tamanho: quantidade de posições que o navio ocupa
+ *   - orientacao: 'H' para horizontal, 'V' para vertical,
+ *                 'D' para diagonal baixo-direita, 'E' para diagonal baixo-esquerda
+ * Retorno: 1 se a posição é válida, 0 se é inválida
+ */
+int validarPosicaoOriginal(int linha, int coluna, int tamanho, char orientacao) {
+    // Valida se a linha e coluna iniciais estão dentro do tabuleiro
+    if (linha < 0 || linha >= TAMANHO_TABULEIRO ||
+        coluna < 0 || coluna >= TAMANHO_TABULEIRO) {
+        return 0;  // Posição inicial inválida
+    }
+
+    // Valida orientação horizontal
+    if (orientacao == 'H' || orientacao == 'h') {
+        // Verifica se o navio cabe horizontalmente
+        if (coluna + tamanho > TAMANHO_TABULEIRO) {
+            return 0;  // Navio ultrapassa o limite à direita
+        }
+    }
+    // Valida orientação vertical
+    else if (orientacao == 'V' || orientacao == 'v') {
+        // Verifica se o navio cabe verticalmente
+        if (linha + tamanho > TAMANHO_TABULEIRO) {
+            return 0;  // Navio ultrapassa o limite inferior
+        }
+    }
+    // Valida orientação diagonal para baixo-direita (↘)
+    else if (orientacao == 'D' || orientacao == 'd') {
+        // Verifica se o navio cabe na diagonal (linha e coluna aumentam)
+        if (linha + tamanho > TAMANHO_TABULEIRO ||
+            coluna + tamanho > TAMANHO_TABULEIRO) {
+            return 0;  // Navio ultrapassa os limites
+        }
+    }
+    // Valida orientação diagonal para baixo-esquerda (↙)
+    else if (orientacao == 'E' || orientacao == 'e') {
+        // Verifica se o navio cabe na diagonal (linha aumenta, coluna diminui)
+        if (linha + tamanho > TAMANHO_TABULEIRO ||
+            coluna - tamanho + 1 < 0) {
+            return 0;  // Navio ultrapassa os limites
+        }
+    }
+    else {
+        return 0;  // Orientação inválida
+    }
+
+    return 1;  // Posição válida
+}
+
+/*
+ * Função: verificarSobreposicaoOriginal
+ * Propósito: Verifica se as posições que o navio ocupará já estão ocupadas
+ * Parâmetros:
+ *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
+ *   - linha: linha inicial do navio
+ *   - coluna: coluna inicial do navio
+ *   - tamanho: quantidade de posições que o navio ocupa
+ *   - orientacao: 'H' para horizontal, 'V' para vertical,
+ *                 'D' para diagonal baixo-direita, 'E' para diagonal baixo-esquerda
+ * Retorno: 1 se houver sobreposição, 0 se estiver livre
+ */
+int verificarSobreposicaoOriginal(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                          int linha, int coluna, int tamanho, char orientacao) {
+    // Verifica sobreposição para navio horizontal
+    if (orientacao == 'H' || orientacao == 'h') {
+        // Percorre todas as colunas que o navio ocupará
+        for (int j = coluna; j < coluna + tamanho; j++) {
+            if (tabuleiro[linha][j] != AGUA) {
+                return 1;  // Há sobreposição
+            }
+        }
+    }
+    // Verifica sobreposição para navio vertical
+    else if (orientacao == 'V' || orientacao == 'v') {
+        // Percorre todas as linhas que o navio ocupará
+        for (int i = linha; i < linha + tamanho; i++) {
+            if (tabuleiro[i][coluna] != AGUA) {
+                return 1;  // Há sobreposição
+            }
+        }
+    }
+    // Verifica sobreposição para navio diagonal baixo-direita (↘)
+    else if (orientacao == 'D' || orientacao == 'd') {
+        // Percorre as posições na diagonal (linha e coluna aumentam)
+        for (int i = 0; i < tamanho; i++) {
+            if (tabuleiro[linha + i][coluna + i] != AGUA) {
+                return 1;  // Há sobreposição
+            }
+        }
+    }
+    // Verifica sobreposição para navio diagonal baixo-esquerda (↙)
+    else if (orientacao == 'E' || orientacao == 'e') {
+        // Percorre as posições na diagonal (linha aumenta, coluna diminui)
+        for (int i = 0; i < tamanho; i++) {
+            if (tabuleiro[linha + i][coluna - i] != AGUA) {
+                return 1;  // Há sobreposição
+            }
+        }
+    }
+
+    return 0;  // Não há sobreposição
+}
+
+/*
+ * Função: posicionarNavioOriginal
+ * Propósito: Posiciona um navio no tabuleiro, marcando suas posições com o valor 3
+ * Parâmetros:
+ *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
+ *   - linha: linha inicial do navio
+ *   - coluna: coluna inicial do navio
+ *   - orientacao: 'H' para horizontal, 'V' para vertical,
+ *                 'D' para diagonal baixo-direita, 'E' para diagonal baixo-esquerda
+ * Retorno: void (não retorna valor)
+ * Nota: Assume que a validação já foi feita antes de chamar esta função
+ */
+void posicionarNavioOriginal(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                     int linha, int coluna, char orientacao) {
+    // Posiciona navio horizontal
+    if (orientacao == 'H' || orientacao == 'h') {
+        // Marca cada posição do navio horizontalmente
+        for (int j = coluna; j < coluna + TAMANHO_NAVIO; j++) {
+            tabuleiro[linha][j] = NAVIO;
+        }
+    }
+    // Posiciona navio vertical
+    else if (orientacao == 'V' || orientacao == 'v') {
+        // Marca cada posição do navio verticalmente
+        for (int i = linha; i < linha + TAMANHO_NAVIO; i++) {
+            tabuleiro[i][coluna] = NAVIO;
+        }
+    }
+    // Posiciona navio diagonal para baixo-direita (↘)
+    else if (orientacao == 'D' || orientacao == 'd') {
+        // Marca cada posição do navio na diagonal (linha e coluna aumentam)
+        for (int i = 0; i < TAMANHO_NAVIO; i++) {
+            tabuleiro[linha + i][coluna + i] = NAVIO;
+        }
+    }
+    // Posiciona navio diagonal para baixo-esquerda (↙)
+    else if (orientacao == 'E' || orientacao == 'e') {
+        // Marca cada posição do navio na diagonal (linha aumenta, coluna diminui)
+        for (int i = 0; i < TAMANHO_NAVIO; i++) {
+            tabuleiro[linha + i][coluna - i] = NAVIO;
+        }
+    }
+}
+
+/*
+ * Função: criarMatrizConeOriginal
+ * Propósito: Cria dinamicamente uma matriz representando área de efeito em forma de cone
+ * Parâmetros:
+ *   - matriz: matriz 7x7 que receberá o padrão de cone
+ * Retorno: void (não retorna valor)
+ * Lógica: O cone expande do topo (linha 0) para baixo, aumentando largura
+ */
+void criarMatrizConeOriginal(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]) {
+    int centro = TAMANHO_MATRIZ_HABILIDADE / 2;  // Centro da matriz (índice 3 para 7x7)
+
+    // Loop aninhado para percorrer toda a matriz
+    for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
+        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
+            // Lógica do cone: expandir a partir do centro conforme linha aumenta
+            // Na linha 0: apenas centro
+            // Na linha 1: centro +/- 1
+            // Na linha 2: centro +/- 2
+            // Quando atinge largura máxima, continua preenchido
+            if (i <= centro) {
+                // Fase de expansão: largura aumenta com a linha
+                if (j >= centro - i && j <= centro + i) {
+                    matriz[i][j] = 1;
+                } else {
+                    matriz[i][j] = 0;
+                }
+            } else {
+                // Após atingir largura máxima, mantém tudo preenchido
+                matriz[i][j] = 1;
+            }
+        }
+    }
+}
+
+/*
+ * Função: criarMatrizCruzOriginal
+ * Propósito: Cria dinamicamente uma matriz representando área de efeito em forma de cruz
+ * Parâmetros:
+ *   - matriz: matriz 7x7 que receberá o padrão de cruz
+ * Retorno: void (não retorna valor)
+ * Lógica: Marca linha central E coluna central, formando uma cruz
+ */
+void criarMatrizCruzOriginal(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]) {
+    int centro = TAMANHO_MATRIZ_HABILIDADE / 2;  // Centro da matriz (índice 3 para 7x7)
+
+    // Loop aninhado para percorrer toda a matriz
+    for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
+        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
+            // Lógica da cruz: marcar se está na linha central OU na coluna central
+            if (i == centro || j == centro) {
+                matriz[i][j] = 1;
+            } else {
+                matriz[i][j] = 0;
+            }
+        }
+    }
+}
+
+/*
+ * Função: criarMatrizOctaedroOriginal
+ * Propósito: Cria dinamicamente uma matriz representando área de efeito em forma de losango
+ * Parâmetros:
+ *   - matriz: matriz 7x7 que receberá o padrão de losango (vista frontal de octaedro)
+ * Retorno: void (não retorna valor)
+ * Lógica: Usa distância Manhattan para criar formato de diamante
+ */
+void criarMatrizOctaedroOriginal(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]) {
+    int centro = TAMANHO_MATRIZ_HABILIDADE / 2;  // Centro da matriz (índice 3 para 7x7)
+
+    // Loop aninhado para percorrer toda a matriz
+    for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
+        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
+            // Lógica do octaedro/losango: usar distância Manhattan
+            // Distância Manhattan = |linha - centro| + |coluna - centro|
+            // Se distância <= raio (centro), está dentro do losango
+            int distancia = abs(i - centro) + abs(j - centro);
+
+            if (distancia <= centro) {
+                matriz[i][j] = 1;
+            } else {
+                matriz[i][j] = 0;
+            }
+        }
+    }
+}
+
+/*
+ * Função: aplicarHabilidadeOriginal
+ * Propósito: Sobrepõe a matriz de habilidade no tabuleiro, centrando no ponto de origem
+ * Parâmetros:
+ *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
+ *   - matrizHabilidade: matriz 7x7 representando a área de efeito
+ *   - origem_linha: linha central onde a habilidade será aplicada
+ *   - origem_coluna: coluna central onde a habilidade será aplicada
+ * Retorno: void (não retorna valor)
+ * Lógica: Sobrepõe a matriz centralizando no ponto de origem, respeitando limites
+ */
+void aplicarHabilidadeOriginal(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                       int matrizHabilidade[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE],
+                       int origem_linha, int origem_coluna) {
+    int deslocamento = TAMANHO_MATRIZ_HABILIDADE / 2;  // Deslocamento para centralizar (3 para 7x7)
+
+    // Loop aninhado para percorrer a matriz de habilidade
+    for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
+        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
+            // Calcular posição correspondente no tabuleiro
+            // Subtrair deslocamento para centralizar a matriz no ponto de origem
+            int tab_i = origem_linha - deslocamento + i;
+            int tab_j = origem_coluna - deslocamento + j;
+
+            // Verificar se a posição está dentro dos limites do tabuleiro
+            if (tab_i >= 0 && tab_i < TAMANHO_TABULEIRO &&
+                tab_j >= 0 && tab_j < TAMANHO_TABULEIRO) {
+
+                // Se a posição da matriz de habilidade está marcada (valor 1)
+                // E a posição no tabuleiro é água (valor 0), aplicar habilidade
+                if (matrizHabilidade[i][j] == 1 && tabuleiro[tab_i][tab_j] == AGUA) {
+                    tabuleiro[tab_i][tab_j] = HABILIDADE;
+                }
+                // Nota: Não sobrescrever navios (valor 3)
+            }
+        }
+    }
+}
@@ -0,0 +1,23 @@
+/*
+ * Arquivo: fuzz/referencia.h
+ * Descrição: Funções originais do tabuleiro, mantidas como referência do teste diferencial
+ */
+
+#ifndef BATALHA_NAVAL_REFERENCIA_H
+#define BATALHA_NAVAL_REFERENCIA_H
+
+#include "batalha_naval_interno.h"
+
+int validarPosicaoOriginal(int linha, int coluna, int tamanho, char orientacao);
+int verificarSobreposicaoOriginal(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                                  int linha, int coluna, int tamanho, char orientacao);
+void posicionarNavioOriginal(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                             int linha, int coluna, char orientacao);
+void criarMatrizConeOriginal(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]);
+void criarMatrizCruzOriginal(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]);
+void criarMatrizOctaedroOriginal(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]);
+void aplicarHabilidadeOriginal(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                               int matrizHabilidade[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE],
+                               int origem_linha, int origem_coluna);
+
+#endif  // BATALHA_NAVAL_REFERENCIA_H
@@ -0,0 +1,121 @@
+/*
+ * Biblioteca: Batalha Naval
+ * Arquivo: include/batalha_naval.h
+ * Descrição: API pública e estável do motor de Batalha Naval. O tabuleiro é
+ *            acessado apenas por um identificador opaco (BNTabuleiro); a
+ *            representação interna pode mudar sem quebrar os programas que
+ *            usam a biblioteca.
+ * Nota: Todas as funções podem ser chamadas de várias threads ao mesmo tempo,
+ *       desde que cada tabuleiro seja usado por uma thread de cada vez. As
+ *       tabelas internas são geradas uma única vez (pthread_once) na primeira
+ *       chamada que precisar delas, de qualquer thread; não há função de
+ *       inicialização a chamar antes.
+ */
+
+#ifndef BATALHA_NAVAL_H
+#define BATALHA_NAVAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Símbolos exportados pela biblioteca compartilhada. Quem usa a biblioteca
+// estática no Windows deve definir BATALHA_NAVAL_ESTATICA.
+#if defined(_WIN32) && !defined(BATALHA_NAVAL_ESTATICA)
+#ifdef BATALHA_NAVAL_COMPILANDO
+#define BATALHA_NAVAL_API __declspec(dllexport)
+#else
+#define BATALHA_NAVAL_API __declspec(dllimport)
+#endif
+#elif defined(__GNUC__)
+#define BATALHA_NAVAL_API __attribute__((visibility("default")))
+#else
+#define BATALHA_NAVAL_API
+#endif
+
+#define BN_VERSAO_MAIOR 1
+#define BN_VERSAO_MENOR 2
+#define BN_VERSAO_CORRECAO 0
+
+#define BN_TAMANHO_TABULEIRO 10         // Tabuleiro 10x10
+#define BN_TAMANHO_NAVIO 3              // Navios de 3 posições
+#define BN_TAMANHO_TEXTO_TABULEIRO 512  // Buffer suficiente para bnFormatarTabuleiro
+
+// Valores de célula (os mesmos da matriz tradicional)
+#define BN_AGUA 0
+#define BN_NAVIO 3
+#define BN_HABILIDADE 5
+
+// Códigos de retorno
+#define BN_OK 0
+#define BN_ERRO_ARGUMENTO -1     // Ponteiro nulo, forma, raio ou célula inválidos
+#define BN_ERRO_POSICAO -2       // Navio ultrapassa os limites do tabuleiro
+#define BN_ERRO_SOBREPOSICAO -3  // Navio cobre um navio ou área de habilidade
+#define BN_ERRO_MEMORIA -4
+
+// Resultado de bnRegistrarTiro e bnDispararTiro
+#define BN_TIRO_AGUA 0
+#define BN_TIRO_ACERTO 1
+#define BN_TIRO_AFUNDOU 2      // Apenas bnDispararTiro: última célula de um navio
+#define BN_TIRO_FIM_DE_JOGO 3  // Apenas bnDispararTiro: último navio da frota
+#define BN_TIRO_REPETIDO 4     // Apenas bnDispararTiro: célula já atingida antes
+
+// Formatos de área de efeito
+typedef enum {
+    BN_FORMA_CONE,
+    BN_FORMA_CRUZ,
+    BN_FORMA_OCTAEDRO,
+    BN_FORMA_CIRCULO,
+    BN_FORMA_ANEL
+} BNForma;
+
+// Tabuleiro opaco: criado por bnCriarTabuleiro e liberado por bnLiberarTabuleiro
+typedef struct BNTabuleiro BNTabuleiro;
+
+// Versão da biblioteca no formato "maior.menor.correcao"
+BATALHA_NAVAL_API const char *bnVersao(void);
+
+// ---------- Ciclo de vida ----------
+
+BATALHA_NAVAL_API BNTabuleiro *bnCriarTabuleiro(void);
+BATALHA_NAVAL_API void bnLiberarTabuleiro(BNTabuleiro *tabuleiro);
+BATALHA_NAVAL_API BNTabuleiro *bnDuplicarTabuleiro(const BNTabuleiro *tabuleiro);
+BATALHA_NAVAL_API void bnCopiarTabuleiro(const BNTabuleiro *origem, BNTabuleiro *destino);
+BATALHA_NAVAL_API void bnLimparTabuleiro(BNTabuleiro *tabuleiro);
+
+// ---------- Navios ----------
+
+BATALHA_NAVAL_API int bnValidarPosicao(int linha, int coluna, int tamanho, char orientacao);
+BATALHA_NAVAL_API int bnVerificarSobreposicao(const BNTabuleiro *tabuleiro, int linha, int coluna,
+                                              int tamanho, char orientacao);
+BATALHA_NAVAL_API int bnPosicionarNavio(BNTabuleiro *tabuleiro, int linha, int coluna,
+                                        char orientacao);
+BATALHA_NAVAL_API int bnSortearFrota(BNTabuleiro *tabuleiro, uint64_t semente);
+
+// ---------- Habilidades e tiros ----------
+
+BATALHA_NAVAL_API int bnAplicarHabilidade(BNTabuleiro *tabuleiro, BNForma forma, int raio,
+                                          int linha, int coluna);
+BATALHA_NAVAL_API int bnRegistrarTiro(BNTabuleiro *tabuleiro, int linha, int coluna);
+BATALHA_NAVAL_API int bnDispararTiro(BNTabuleiro *tabuleiro, int linha, int coluna, int *navio);
+BATALHA_NAVAL_API int bnFrotaAfundada(const BNTabuleiro *tabuleiro);
+BATALHA_NAVAL_API int bnNaviosRestantes(const BNTabuleiro *tabuleiro);
+BATALHA_NAVAL_API int bnSugerirTiro(const BNTabuleiro *tabuleiro, int *linha, int *coluna);
+
+// ---------- Consulta e exibição ----------
+
+BATALHA_NAVAL_API int bnValorCelula(const BNTabuleiro *tabuleiro, int linha, int coluna);
+BATALHA_NAVAL_API uint64_t bnHashTabuleiro(const BNTabuleiro *tabuleiro);
+BATALHA_NAVAL_API void bnExportarMatriz(const BNTabuleiro *tabuleiro,
+                                        int matriz[BN_TAMANHO_TABULEIRO][BN_TAMANHO_TABULEIRO]);
+BATALHA_NAVAL_API size_t bnFormatarTabuleiro(const BNTabuleiro *tabuleiro, char *buffer,
+                                             size_t tamanho);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BATALHA_NAVAL_H
@@ -0,0 +1,22 @@
+/*
+ * Arquivo: src/aleatorio.c
+ * Descrição: Gerador pseudoaleatório reprodutível (xoshiro256**)
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== GERADOR PSEUDOALEATÓRIO REPRODUTÍVEL ==========
+
+/*
+ * Função: semearGerador
+ * Propósito: Inicializa o gerador a partir de uma semente de 64 bits
+ * Parâmetros:
+ *   - gerador: gerador a ser inicializado
+ *   - semente: qualquer valor (inclusive 0)
+ * Retorno: void (não retorna valor)
+ */
+void semearGerador(GeradorAleatorio *gerador, uint64_t semente) {
+    for (int i = 0; i < 4; i++) {
+        gerador->estado[i] = splitmix64(&semente);
+    }
+}
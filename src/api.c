@@ -0,0 +1,343 @@
+/*
+ * Arquivo: src/api.c
+ * Descrição: Implementação da API pública (batalha_naval.h) sobre o motor em bits
+ */
+
+#include "batalha_naval.h"
+#include "batalha_naval_interno.h"
+
+// A API pública repete os valores internos; qualquer divergência quebra a compilação
+_Static_assert(BN_TAMANHO_TABULEIRO == TAMANHO_TABULEIRO, "tamanho do tabuleiro divergente");
+_Static_assert(BN_TAMANHO_NAVIO == TAMANHO_NAVIO, "tamanho do navio divergente");
+_Static_assert(BN_AGUA == AGUA && BN_NAVIO == NAVIO && BN_HABILIDADE == HABILIDADE,
+               "valores de célula divergentes");
+_Static_assert(BN_TAMANHO_TEXTO_TABULEIRO >= TAMANHO_BUFFER_TABULEIRO,
+               "buffer de texto menor que o tabuleiro formatado");
+_Static_assert(BN_TIRO_AGUA == TIRO_AGUA && BN_TIRO_ACERTO == TIRO_ACERTO &&
+               BN_TIRO_AFUNDOU == TIRO_AFUNDOU && BN_TIRO_FIM_DE_JOGO == TIRO_FIM_DE_JOGO &&
+               BN_TIRO_REPETIDO == TIRO_REPETIDO,
+               "resultados de tiro divergentes");
+_Static_assert((int)BN_FORMA_CONE == (int)FORMA_CONE && (int)BN_FORMA_CRUZ == (int)FORMA_CRUZ &&
+               (int)BN_FORMA_OCTAEDRO == (int)FORMA_OCTAEDRO &&
+               (int)BN_FORMA_CIRCULO == (int)FORMA_CIRCULO && (int)BN_FORMA_ANEL == (int)FORMA_ANEL,
+               "formas divergentes");
+
+#define TEXTO_VERSAO_(a, b, c) #a "." #b "." #c
+#define TEXTO_VERSAO(a, b, c) TEXTO_VERSAO_(a, b, c)
+
+/*
+ * Tipo: BNTabuleiro
+ * Propósito: Conteúdo do identificador opaco da API (visível apenas aqui)
+ */
+struct BNTabuleiro {
+    TabuleiroBits bits;
+    TabelaNavios navios;  // Identidade dos navios; acompanha bits.navios
+};
+
+// Retorna 1 se (linha, coluna) está dentro do tabuleiro
+static int celulaValida(int linha, int coluna) {
+    return linha >= 0 && linha < TAMANHO_TABULEIRO && coluna >= 0 && coluna < TAMANHO_TABULEIRO;
+}
+
+/*
+ * Função: bnVersao
+ * Propósito: Informa a versão da biblioteca
+ * Retorno: texto constante "maior.menor.correcao"
+ */
+const char *bnVersao(void) {
+    return TEXTO_VERSAO(BN_VERSAO_MAIOR, BN_VERSAO_MENOR, BN_VERSAO_CORRECAO);
+}
+
+/*
+ * Função: bnCriarTabuleiro
+ * Propósito: Cria um tabuleiro vazio (todas as células com água)
+ * Retorno: novo tabuleiro, ou NULL se faltar memória. Liberar com bnLiberarTabuleiro.
+ */
+BNTabuleiro *bnCriarTabuleiro(void) {
+    BNTabuleiro *tabuleiro = malloc(sizeof(BNTabuleiro));
+    if (tabuleiro != NULL) {
+        inicializarTabelaPosicionamentos();
+        inicializarTabuleiroBits(&tabuleiro->bits);
+        iniciarTabelaNavios(&tabuleiro->navios);
+    }
+    return tabuleiro;
+}
+
+/*
+ * Função: bnLiberarTabuleiro
+ * Propósito: Libera um tabuleiro criado pela API (aceita NULL)
+ */
+void bnLiberarTabuleiro(BNTabuleiro *tabuleiro) {
+    free(tabuleiro);
+}
+
+/*
+ * Função: bnDuplicarTabuleiro
+ * Propósito: Cria um novo tabuleiro idêntico ao informado
+ * Retorno: cópia independente, ou NULL se faltar memória ou o tabuleiro for NULL
+ */
+BNTabuleiro *bnDuplicarTabuleiro(const BNTabuleiro *tabuleiro) {
+    BNTabuleiro *copia;
+    if (tabuleiro == NULL || (copia = malloc(sizeof(BNTabuleiro))) == NULL) {
+        return NULL;
+    }
+    *copia = *tabuleiro;
+    return copia;
+}
+
+/*
+ * Função: bnCopiarTabuleiro
+ * Propósito: Copia o conteúdo de um tabuleiro para outro já criado
+ */
+void bnCopiarTabuleiro(const BNTabuleiro *origem, BNTabuleiro *destino) {
+    if (origem != NULL && destino != NULL) {
+        *destino = *origem;
+    }
+}
+
+/*
+ * Função: bnLimparTabuleiro
+ * Propósito: Remove navios, áreas de habilidade e tiros
+ */
+void bnLimparTabuleiro(BNTabuleiro *tabuleiro) {
+    if (tabuleiro != NULL) {
+        inicializarTabuleiroBits(&tabuleiro->bits);
+        iniciarTabelaNavios(&tabuleiro->navios);
+    }
+}
+
+/*
+ * Função: bnValidarPosicao
+ * Propósito: Verifica se um navio cabe inteiro no tabuleiro
+ * Parâmetros:
+ *   - linha, coluna: posição inicial
+ *   - tamanho: posições ocupadas (1 a BN_TAMANHO_TABULEIRO)
+ *   - orientacao: 'H', 'V', 'D' ou 'E'
+ * Retorno: 1 se cabe, 0 caso contrário
+ */
+int bnValidarPosicao(int linha, int coluna, int tamanho, char orientacao) {
+    if (tamanho < 1 || tamanho > TAMANHO_TABULEIRO) {
+        return 0;
+    }
+    inicializarTabelaPosicionamentos();
+    return validarPosicao(linha, coluna, tamanho, orientacao);
+}
+
+/*
+ * Função: bnVerificarSobreposicao
+ * Propósito: Verifica se um navio cobriria um navio ou área de habilidade
+ * Retorno: 1 se há sobreposição, 0 se a posição está livre, BN_ERRO_POSICAO se o
+ *          navio não cabe no tabuleiro, BN_ERRO_ARGUMENTO se o tabuleiro for NULL
+ */
+int bnVerificarSobreposicao(const BNTabuleiro *tabuleiro, int linha, int coluna,
+                            int tamanho, char orientacao) {
+    if (tabuleiro == NULL) {
+        return BN_ERRO_ARGUMENTO;
+    }
+    if (!bnValidarPosicao(linha, coluna, tamanho, orientacao)) {
+        return BN_ERRO_POSICAO;
+    }
+    return verificarSobreposicaoBits(&tabuleiro->bits, linha, coluna, tamanho, orientacao);
+}
+
+/*
+ * Função: bnPosicionarNavio
+ * Propósito: Valida e posiciona um navio de BN_TAMANHO_NAVIO posições
+ * Retorno: BN_OK, BN_ERRO_POSICAO, BN_ERRO_SOBREPOSICAO ou BN_ERRO_ARGUMENTO
+ */
+int bnPosicionarNavio(BNTabuleiro *tabuleiro, int linha, int coluna, char orientacao) {
+    int sobreposicao = bnVerificarSobreposicao(tabuleiro, linha, coluna, TAMANHO_NAVIO, orientacao);
+    if (sobreposicao < 0) {
+        return sobreposicao;
+    }
+    if (sobreposicao) {
+        return BN_ERRO_SOBREPOSICAO;
+    }
+    posicionarNavioBits(&tabuleiro->bits, linha, coluna, orientacao);
+    adicionarNavioRastreado(&tabuleiro->navios, consultarPosicionamento(linha, coluna, orientacao));
+    return BN_OK;
+}
+
+/*
+ * Função: bnSortearFrota
+ * Propósito: Substitui o conteúdo do tabuleiro por uma frota sorteada uniformemente
+ *            entre todas as frotas legais de 4 navios
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro de destino
+ *   - semente: a mesma semente sempre gera a mesma frota
+ * Retorno: BN_OK ou BN_ERRO_ARGUMENTO
+ */
+int bnSortearFrota(BNTabuleiro *tabuleiro, uint64_t semente) {
+    GeradorAleatorio gerador;
+    Frota frota;
+
+    if (tabuleiro == NULL) {
+        return BN_ERRO_ARGUMENTO;
+    }
+    semearGerador(&gerador, semente);
+    gerarFrota(&gerador, FROTA_UNIFORME, &frota);
+    inicializarTabuleiroBits(&tabuleiro->bits);
+    posicionarFrotaBits(&tabuleiro->bits, &frota);
+    rastrearFrota(&tabuleiro->navios, &frota);
+    return BN_OK;
+}
+
+/*
+ * Função: bnAplicarHabilidade
+ * Propósito: Marca a área de uma habilidade nas células de água
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro de destino
+ *   - forma: formato da área
+ *   - raio: 0 a 31 (3 reproduz as matrizes 7x7 tradicionais)
+ *   - linha, coluna: centro da área (pode ficar fora do tabuleiro; a área é recortada)
+ * Retorno: BN_OK ou BN_ERRO_ARGUMENTO
+ */
+int bnAplicarHabilidade(BNTabuleiro *tabuleiro, BNForma forma, int raio, int linha, int coluna) {
+    const FormaHabilidade *registro = obterForma((TipoForma)forma, raio);
+    if (tabuleiro == NULL || registro == NULL) {
+        return BN_ERRO_ARGUMENTO;
+    }
+    aplicarFormaBits(&tabuleiro->bits, registro, linha, coluna);
+    return BN_OK;
+}
+
+/*
+ * Função: bnRegistrarTiro
+ * Propósito: Registra um tiro na célula informada
+ * Retorno: BN_TIRO_ACERTO se a célula tem navio (mesmo que já atingida antes),
+ *          BN_TIRO_AGUA ou BN_ERRO_ARGUMENTO
+ */
+int bnRegistrarTiro(BNTabuleiro *tabuleiro, int linha, int coluna) {
+    int navio;
+    if (tabuleiro == NULL || !celulaValida(linha, coluna)) {
+        return BN_ERRO_ARGUMENTO;
+    }
+    resolverTiro(&tabuleiro->navios, &tabuleiro->bits, INDICE_CELULA(linha, coluna), &navio);
+    return navio >= 0 ? BN_TIRO_ACERTO : BN_TIRO_AGUA;
+}
+
+/*
+ * Função: bnDispararTiro
+ * Propósito: Registra um tiro e informa o efeito completo em O(1)
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro adversário
+ *   - linha, coluna: célula atingida
+ *   - navio: recebe o navio da célula (0, 1, 2... na ordem de posicionamento)
+ *            ou -1 se for água; pode ser NULL
+ * Retorno: BN_TIRO_AGUA, BN_TIRO_ACERTO, BN_TIRO_AFUNDOU, BN_TIRO_FIM_DE_JOGO,
+ *          BN_TIRO_REPETIDO ou BN_ERRO_ARGUMENTO
+ */
+int bnDispararTiro(BNTabuleiro *tabuleiro, int linha, int coluna, int *navio) {
+    if (tabuleiro == NULL || !celulaValida(linha, coluna)) {
+        return BN_ERRO_ARGUMENTO;
+    }
+    return (int)resolverTiro(&tabuleiro->navios, &tabuleiro->bits, INDICE_CELULA(linha, coluna),
+                             navio);
+}
+
+/*
+ * Função: bnFrotaAfundada
+ * Propósito: Informa se todos os navios já foram afundados
+ * Retorno: 1 se a frota inteira foi afundada (ou não há navios), 0 caso contrário
+ */
+int bnFrotaAfundada(const BNTabuleiro *tabuleiro) {
+    return tabuleiro != NULL && tabuleiro->navios.naviosRestantes == 0;
+}
+
+/*
+ * Função: bnNaviosRestantes
+ * Propósito: Informa quantos navios ainda não foram afundados
+ * Retorno: quantidade de navios, ou BN_ERRO_ARGUMENTO se o tabuleiro for NULL
+ */
+int bnNaviosRestantes(const BNTabuleiro *tabuleiro) {
+    return tabuleiro != NULL ? tabuleiro->navios.naviosRestantes : BN_ERRO_ARGUMENTO;
+}
+
+/*
+ * Função: bnSugerirTiro
+ * Propósito: Sugere o próximo tiro pela densidade de probabilidade, usando
+ *            apenas os tiros já registrados (a frota não é consultada)
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro adversário
+ *   - linha, coluna: recebem a célula sugerida
+ * Retorno: BN_OK, ou BN_ERRO_ARGUMENTO se não houver célula livre ou ponteiros forem NULL
+ */
+int bnSugerirTiro(const BNTabuleiro *tabuleiro, int *linha, int *coluna) {
+    EstadoCaca caca;
+    int alvo;
+
+    if (tabuleiro == NULL || linha == NULL || coluna == NULL) {
+        return BN_ERRO_ARGUMENTO;
+    }
+    iniciarCacaDoTabuleiro(&caca, &tabuleiro->bits);
+    alvo = escolherAlvo(&caca);
+    if (alvo < 0) {
+        return BN_ERRO_ARGUMENTO;
+    }
+    *linha = alvo / TAMANHO_TABULEIRO;
+    *coluna = alvo % TAMANHO_TABULEIRO;
+    return BN_OK;
+}
+
+/*
+ * Função: bnValorCelula
+ * Propósito: Lê uma célula no formato da matriz tradicional
+ * Retorno: BN_AGUA, BN_NAVIO, BN_HABILIDADE ou BN_ERRO_ARGUMENTO
+ */
+int bnValorCelula(const BNTabuleiro *tabuleiro, int linha, int coluna) {
+    int indice;
+    if (tabuleiro == NULL || !celulaValida(linha, coluna)) {
+        return BN_ERRO_ARGUMENTO;
+    }
+    indice = INDICE_CELULA(linha, coluna);
+    if (bitboardContemCelula(tabuleiro->bits.navios, indice)) {
+        return NAVIO;
+    }
+    return bitboardContemCelula(tabuleiro->bits.habilidade, indice) ? HABILIDADE : AGUA;
+}
+
+/*
+ * Função: bnHashTabuleiro
+ * Propósito: Hash de Zobrist de 64 bits do tabuleiro (navios, habilidades e tiros),
+ *            igual para a mesma posição alcançada por qualquer ordem de jogadas
+ * Retorno: hash do tabuleiro, ou 0 se o tabuleiro for NULL
+ */
+uint64_t bnHashTabuleiro(const BNTabuleiro *tabuleiro) {
+    return tabuleiro != NULL ? tabuleiro->bits.hash : 0;
+}
+
+/*
+ * Função: bnExportarMatriz
+ * Propósito: Converte o tabuleiro na matriz 10x10 tradicional (0, 3 e 5)
+ */
+void bnExportarMatriz(const BNTabuleiro *tabuleiro,
+                      int matriz[BN_TAMANHO_TABULEIRO][BN_TAMANHO_TABULEIRO]) {
+    if (tabuleiro != NULL && matriz != NULL) {
+        expandirTabuleiro(&tabuleiro->bits, matriz);
+    }
+}
+
+/*
+ * Função: bnFormatarTabuleiro
+ * Propósito: Escreve o tabuleiro como texto, no mesmo formato da demonstração
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro a ser formatado
+ *   - buffer: destino (BN_TAMANHO_TEXTO_TABULEIRO bytes sempre bastam)
+ *   - tamanho: capacidade de buffer, em bytes
+ * Retorno: comprimento do texto, sem o terminador nulo. Se for maior ou igual a
+ *          tamanho, nada é escrito (como em snprintf, o valor indica o necessário).
+ */
+size_t bnFormatarTabuleiro(const BNTabuleiro *tabuleiro, char *buffer, size_t tamanho) {
+    char texto[TAMANHO_BUFFER_TABULEIRO];
+    size_t comprimento;
+
+    if (tabuleiro == NULL) {
+        return 0;
+    }
+    comprimento = formatarTabuleiroBits(&tabuleiro->bits, texto);
+    if (buffer != NULL && comprimento < tamanho) {
+        memcpy(buffer, texto, comprimento);
+        buffer[comprimento] = '\0';
+    }
+    return comprimento;
+}
@@ -0,0 +1,208 @@
+/*
+ * Arquivo: src/arena.c
+ * Descrição: Arena de memória com alocação por incremento, reinício em O(1) e
+ *            uma arena própria para cada thread
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== ARENA DE MEMÓRIA ==========
+
+/*
+ * Tipo: BlocoArena
+ * Propósito: Cabeçalho de um bloco; os dados começam na linha de cache seguinte
+ * Campos:
+ *   - proximo: próximo bloco da lista
+ *   - capacidade: bytes de dados do bloco (múltiplo de ALINHAMENTO_CACHE)
+ */
+struct BlocoArena {
+    BlocoArena *proximo;
+    size_t capacidade;
+};
+
+// O cabeçalho ocupa exatamente uma linha de cache, mantendo os dados alinhados
+#define CABECALHO_BLOCO ((sizeof(BlocoArena) + ALINHAMENTO_CACHE - 1) / ALINHAMENTO_CACHE * \
+                         ALINHAMENTO_CACHE)
+
+// Arredonda um tamanho para múltiplo da linha de cache
+static size_t arredondarLinhaCache(size_t tamanho) {
+    return (tamanho + ALINHAMENTO_CACHE - 1) / ALINHAMENTO_CACHE * ALINHAMENTO_CACHE;
+}
+
+// Primeiro byte de dados de um bloco
+static unsigned char *dadosBloco(BlocoArena *bloco) {
+    return (unsigned char *)bloco + CABECALHO_BLOCO;
+}
+
+/*
+ * Função: iniciarArena
+ * Propósito: Prepara uma arena vazia (nenhum bloco é alocado até o primeiro pedido)
+ * Parâmetros:
+ *   - arena: arena a ser preparada
+ *   - tamanhoBloco: capacidade dos blocos, em bytes (0 usa TAMANHO_BLOCO_ARENA)
+ * Retorno: void (não retorna valor)
+ */
+void iniciarArena(Arena *arena, size_t tamanhoBloco) {
+    arena->primeiro = NULL;
+    arena->atual = NULL;
+    arena->usado = 0;
+    arena->tamanhoBloco = arredondarLinhaCache(tamanhoBloco ? tamanhoBloco : TAMANHO_BLOCO_ARENA);
+}
+
+/*
+ * Função: alocarArena
+ * Propósito: Entrega um trecho de memória alinhado à linha de cache
+ * Parâmetros:
+ *   - arena: arena de origem
+ *   - tamanho: bytes desejados (0 é tratado como 1)
+ * Retorno: ponteiro para a memória (sem inicializar), ou NULL se faltar memória
+ * Lógica: Normalmente só avança o deslocamento do bloco atual. Quando o bloco
+ *         acaba, reaproveita o próximo bloco já existente que comporte o pedido
+ *         (os blocos sobrevivem a voltarArena e reiniciarArena) e só então
+ *         aloca um bloco novo, inserido logo após o atual.
+ */
+void *alocarArena(Arena *arena, size_t tamanho) {
+    BlocoArena *bloco;
+
+    tamanho = arredondarLinhaCache(tamanho ? tamanho : 1);
+    if (arena->atual != NULL && arena->atual->capacidade - arena->usado >= tamanho) {
+        void *memoria = dadosBloco(arena->atual) + arena->usado;
+        arena->usado += tamanho;
+        return memoria;
+    }
+
+    bloco = arena->atual != NULL ? arena->atual->proximo : arena->primeiro;
+    while (bloco != NULL && bloco->capacidade < tamanho) {
+        bloco = bloco->proximo;
+    }
+    if (bloco == NULL) {
+        size_t capacidade = tamanho > arena->tamanhoBloco ? tamanho : arena->tamanhoBloco;
+        if (capacidade > SIZE_MAX - CABECALHO_BLOCO ||
+            (bloco = alocarAlinhado(CABECALHO_BLOCO + capacidade)) == NULL) {
+            return NULL;
+        }
+        bloco->capacidade = capacidade;
+        if (arena->atual != NULL) {
+            bloco->proximo = arena->atual->proximo;
+            arena->atual->proximo = bloco;
+        } else {
+            bloco->proximo = arena->primeiro;
+            arena->primeiro = bloco;
+        }
+    }
+
+    arena->atual = bloco;
+    arena->usado = tamanho;
+    return dadosBloco(bloco);
+}
+
+/*
+ * Função: marcarArena
+ * Propósito: Guarda a posição atual da arena
+ * Parâmetros:
+ *   - arena: arena de origem
+ * Retorno: marca para voltarArena
+ */
+MarcaArena marcarArena(const Arena *arena) {
+    MarcaArena marca = {arena->atual, arena->usado};
+    return marca;
+}
+
+/*
+ * Função: voltarArena
+ * Propósito: Descarta, em O(1), tudo o que foi alocado depois da marca
+ * Parâmetros:
+ *   - arena: arena de origem
+ *   - marca: obtida com marcarArena na mesma arena (e ainda não descartada)
+ * Retorno: void (não retorna valor)
+ */
+void voltarArena(Arena *arena, MarcaArena marca) {
+    arena->atual = marca.bloco;
+    arena->usado = marca.usado;
+}
+
+/*
+ * Função: reiniciarArena
+ * Propósito: Descarta, em O(1), todas as alocações (os blocos continuam reservados)
+ * Parâmetros:
+ *   - arena: arena de origem
+ * Retorno: void (não retorna valor)
+ */
+void reiniciarArena(Arena *arena) {
+    arena->atual = NULL;
+    arena->usado = 0;
+}
+
+/*
+ * Função: liberarArena
+ * Propósito: Devolve todos os blocos ao sistema; a arena volta a ficar vazia
+ * Parâmetros:
+ *   - arena: arena de origem
+ * Retorno: void (não retorna valor)
+ */
+void liberarArena(Arena *arena) {
+    BlocoArena *bloco = arena->primeiro;
+    while (bloco != NULL) {
+        BlocoArena *proximo = bloco->proximo;
+        liberarAlinhado(bloco);
+        bloco = proximo;
+    }
+    arena->primeiro = NULL;
+    reiniciarArena(arena);
+}
+
+// ========== ARENA DE CADA THREAD ==========
+
+static pthread_key_t chaveArenaThread;
+static pthread_once_t criacaoChaveArena = PTHREAD_ONCE_INIT;
+static _Thread_local Arena *arenaThreadAtual;  // Atalho para pthread_getspecific
+
+// Destrutor chamado no término de cada thread que usou arenaDaThread
+static void destruirArenaThread(void *memoria) {
+    liberarArena(memoria);
+    free(memoria);
+}
+
+static void criarChaveArena(void) {
+    pthread_key_create(&chaveArenaThread, destruirArenaThread);
+}
+
+/*
+ * Função: arenaDaThread
+ * Propósito: Arena exclusiva da thread chamadora, criada no primeiro uso e
+ *            liberada automaticamente quando a thread termina
+ * Retorno: arena da thread, ou NULL se faltar memória
+ * Nota: Sem disputa entre threads, nenhuma trava é necessária para alocar.
+ *       A thread principal não passa pelo destrutor: use liberarArenaDaThread.
+ */
+Arena *arenaDaThread(void) {
+    if (arenaThreadAtual != NULL) {
+        return arenaThreadAtual;
+    }
+    pthread_once(&criacaoChaveArena, criarChaveArena);
+
+    Arena *arena = malloc(sizeof(Arena));
+    if (arena == NULL) {
+        return NULL;
+    }
+    iniciarArena(arena, 0);
+    if (pthread_setspecific(chaveArenaThread, arena) != 0) {
+        free(arena);
+        return NULL;
+    }
+    arenaThreadAtual = arena;
+    return arena;
+}
+
+/*
+ * Função: liberarArenaDaThread
+ * Propósito: Libera agora a arena da thread chamadora (se existir)
+ * Retorno: void (não retorna valor)
+ */
+void liberarArenaDaThread(void) {
+    if (arenaThreadAtual != NULL) {
+        pthread_setspecific(chaveArenaThread, NULL);
+        destruirArenaThread(arenaThreadAtual);
+        arenaThreadAtual = NULL;
+    }
+}
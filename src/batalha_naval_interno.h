@@ -0,0 +1,1318 @@
+/*
+ * Biblioteca: Batalha Naval
+ * Arquivo: src/batalha_naval_interno.h
+ * Descrição: Tipos, constantes e funções internas do motor, compartilhados pelos
+ *            módulos de src/ e pelos programas do próprio repositório (demonstração
+ *            e benchmark). Programas externos devem usar apenas batalha_naval.h.
+ */
+
+#ifndef BATALHA_NAVAL_INTERNO_H
+#define BATALHA_NAVAL_INTERNO_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// Definição de constantes para facilitar manutenção e legibilidade
+#define TAMANHO_TABULEIRO 10  // Tamanho fixo do tabuleiro (10x10)
+#define TAMANHO_NAVIO 3       // Tamanho fixo de cada navio (3 posições)
+#define AGUA 0                // Valor que representa água no tabuleiro
+#define NAVIO 3               // Valor que representa parte de um navio
+#define HABILIDADE 5          // Valor que representa área afetada por habilidade especial
+#define TAMANHO_MATRIZ_HABILIDADE 7  // Tamanho das matrizes de habilidade (7x7)
+#define CELULAS_TABULEIRO (TAMANHO_TABULEIRO * TAMANHO_TABULEIRO)  // Total de células (100)
+
+#define ALINHAMENTO_CACHE 64   // Tamanho da linha de cache, em bytes
+
+// Converte (linha, coluna) no índice linear da célula (0 a 99)
+#define INDICE_CELULA(linha, coluna) ((linha) * TAMANHO_TABULEIRO + (coluna))
+
+// ========== FUNÇÕES DEPENDENTES DA PLATAFORMA ==========
+
+void *alocarAlinhado(size_t tamanho);
+void liberarAlinhado(void *memoria);
+double relogioSegundos(void);
+int contarNucleos(void);
+
+// ========== INSTRUMENTAÇÃO DAS FUNÇÕES CRÍTICAS ==========
+
+/*
+ * Tipo: PontoInstrumentado
+ * Propósito: Funções medidas quando a biblioteca é compilada com
+ *            BATALHA_INSTRUMENTACAO (opção BATALHA_NAVAL_INSTRUMENTACAO do CMake)
+ * Nota: Sobreposição, posicionamento e habilidade são medidos tanto na matriz
+ *       tradicional quanto no motor em bits (verificarSobreposicaoBits etc.)
+ */
+typedef enum {
+    PONTO_VALIDAR_POSICAO,             // Rejeição: navio fora do tabuleiro
+    PONTO_VERIFICAR_SOBREPOSICAO,      // Rejeição: navio sobre navio ou habilidade
+    PONTO_BUSCAR_POSICIONAMENTO_LIVRE, // Rejeição: fora do tabuleiro ou ocupado
+    PONTO_POSICIONAR_NAVIO,
+    PONTO_APLICAR_HABILIDADE,
+    PONTO_APLICAR_FORMA,
+    QUANTIDADE_PONTOS_INSTRUMENTADOS
+} PontoInstrumentado;
+
+#define FAIXAS_HISTOGRAMA_CICLOS 32  // Faixa k: de 2^k a 2^(k+1) - 1 ciclos (a última é aberta)
+
+/*
+ * Tipo: EstatisticaPonto
+ * Propósito: Totais de uma função instrumentada, somados entre todas as threads
+ * Campos:
+ *   - chamadas: quantidade de chamadas
+ *   - rejeicoes: chamadas que recusaram o navio (só nas funções de validação)
+ *   - ciclos: soma dos ciclos medidos
+ *   - histograma: chamadas por faixa de ciclos (potências de 2)
+ */
+typedef struct {
+    uint64_t chamadas;
+    uint64_t rejeicoes;
+    uint64_t ciclos;
+    uint64_t histograma[FAIXAS_HISTOGRAMA_CICLOS];
+} EstatisticaPonto;
+
+/*
+ * Tipo: FormatoMetricas
+ * Propósito: Formatos de exportação das estatísticas
+ *   - METRICAS_JSON: um objeto JSON por arquivo
+ *   - METRICAS_PROMETHEUS: formato texto de exposição do Prometheus
+ */
+typedef enum {
+    METRICAS_JSON,
+    METRICAS_PROMETHEUS
+} FormatoMetricas;
+
+#ifdef BATALHA_INSTRUMENTACAO
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+// Contador de ciclos do processador
+static inline uint64_t lerCiclos(void) {
+    return __rdtsc();
+}
+#define UNIDADE_CICLOS "ciclos"
+#else
+#include <time.h>
+// Sem contador de ciclos portátil: usa nanossegundos
+static inline uint64_t lerCiclos(void) {
+    struct timespec agora;
+    timespec_get(&agora, TIME_UTC);
+    return (uint64_t)agora.tv_sec * 1000000000u + (uint64_t)agora.tv_nsec;
+}
+#define UNIDADE_CICLOS "ns"
+#endif
+// Abre a medição da função atual (uma por função)
+#define INSTRUMENTAR_INICIO() uint64_t inicioInstrumentacao = lerCiclos()
+// Fecha a medição e registra o resultado
+#define INSTRUMENTAR_FIM(ponto, rejeitada) \
+    registrarMedicao((ponto), lerCiclos() - inicioInstrumentacao, (rejeitada))
+#else
+// Sem BATALHA_INSTRUMENTACAO as medições desaparecem do código gerado
+#define INSTRUMENTAR_INICIO() ((void)0)
+#define INSTRUMENTAR_FIM(ponto, rejeitada) ((void)0)
+#endif
+
+int instrumentacaoAtiva(void);
+void registrarMedicao(PontoInstrumentado ponto, uint64_t ciclos, int rejeitada);
+void coletarInstrumentacao(EstatisticaPonto estatisticas[QUANTIDADE_PONTOS_INSTRUMENTADOS]);
+int escreverMetricas(FILE *arquivo, FormatoMetricas formato);
+int gravarMetricas(const char *caminho, FormatoMetricas formato);
+int iniciarExportacaoMetricas(const char *caminho, FormatoMetricas formato, double intervaloSegundos);
+void pararExportacaoMetricas(void);
+
+// ========== ARENA DE MEMÓRIA ==========
+
+#define TAMANHO_BLOCO_ARENA (64 * 1024)  // Bloco padrão de uma arena, em bytes
+
+// Bloco de memória de uma arena (conteúdo visível apenas em src/arena.c)
+typedef struct BlocoArena BlocoArena;
+
+/*
+ * Tipo: Arena
+ * Propósito: Alocador por incremento de ponteiro sobre uma lista de blocos. Cada
+ *            alocação é alinhada à linha de cache; não há liberação individual,
+ *            apenas o retorno a uma marca ou o reinício da arena inteira, em O(1).
+ *            Os blocos são mantidos para as próximas alocações.
+ * Campos:
+ *   - primeiro: primeiro bloco da lista
+ *   - atual: bloco em uso (NULL = nenhum, a próxima alocação começa em primeiro)
+ *   - usado: bytes já entregues do bloco atual
+ *   - tamanhoBloco: capacidade dos blocos novos (pedidos maiores ganham bloco próprio)
+ */
+typedef struct {
+    BlocoArena *primeiro;
+    BlocoArena *atual;
+    size_t usado;
+    size_t tamanhoBloco;
+} Arena;
+
+/*
+ * Tipo: MarcaArena
+ * Propósito: Posição de uma arena, obtida com marcarArena; voltarArena desfaz
+ *            de uma vez tudo o que foi alocado depois dela
+ */
+typedef struct {
+    BlocoArena *bloco;
+    size_t usado;
+} MarcaArena;
+
+void iniciarArena(Arena *arena, size_t tamanhoBloco);
+void *alocarArena(Arena *arena, size_t tamanho);
+MarcaArena marcarArena(const Arena *arena);
+void voltarArena(Arena *arena, MarcaArena marca);
+void reiniciarArena(Arena *arena);
+void liberarArena(Arena *arena);
+Arena *arenaDaThread(void);
+void liberarArenaDaThread(void);
+
+// ========== TIPOS DO MOTOR EM BITS ==========
+
+/*
+ * Tipo: Bitboard
+ * Propósito: Representa um conjunto de células do tabuleiro como uma máscara de 128 bits
+ * Campos:
+ *   - palavra[0]: bits das células 0 a 63
+ *   - palavra[1]: bits das células 64 a 99 (bits 36 a 63 ficam sempre zerados)
+ * Nota: A célula (linha, coluna) corresponde ao bit INDICE_CELULA(linha, coluna)
+ */
+typedef struct {
+    uint64_t palavra[2];
+} Bitboard;
+
+/*
+ * Tipo: TabuleiroBits
+ * Propósito: Tabuleiro compacto formado por camadas de bits
+ * Campos:
+ *   - navios: células com valor NAVIO
+ *   - habilidade: células com valor HABILIDADE (disjunta de navios)
+ *   - tiros: células que já receberam um tiro; os acertos são tiros & navios
+ *   - hash: hash de Zobrist das três camadas, atualizado por toda função que as
+ *           altera (quem escreve nas camadas diretamente usa hashTabuleiroBits)
+ * Nota: Células fora de navios e habilidade são água. O tabuleiro inteiro ocupa
+ *       56 bytes, contra 400 bytes da matriz int[10][10]. A camada de tiros não
+ *       aparece na matriz tradicional.
+ */
+typedef struct {
+    Bitboard navios;
+    Bitboard habilidade;
+    Bitboard tiros;
+    uint64_t hash;
+} TabuleiroBits;
+
+// ========== OPERAÇÕES BÁSICAS SOBRE BITBOARDS ==========
+
+// Retorna um bitboard sem nenhuma célula marcada
+static inline Bitboard bitboardVazio(void) {
+    Bitboard b = {{0, 0}};
+    return b;
+}
+
+// Retorna um bitboard contendo apenas a célula de índice informado
+static inline Bitboard bitboardCelula(int indice) {
+    Bitboard b = {{0, 0}};
+    b.palavra[indice >> 6] = (uint64_t)1 << (indice & 63);
+    return b;
+}
+
+// União de dois conjuntos de células (a | b)
+static inline Bitboard bitboardOu(Bitboard a, Bitboard b) {
+    Bitboard r = {{a.palavra[0] | b.palavra[0], a.palavra[1] | b.palavra[1]}};
+    return r;
+}
+
+// Interseção de dois conjuntos de células (a & b)
+static inline Bitboard bitboardE(Bitboard a, Bitboard b) {
+    Bitboard r = {{a.palavra[0] & b.palavra[0], a.palavra[1] & b.palavra[1]}};
+    return r;
+}
+
+// Células de a que não estão em b (a & ~b)
+static inline Bitboard bitboardENao(Bitboard a, Bitboard b) {
+    Bitboard r = {{a.palavra[0] & ~b.palavra[0], a.palavra[1] & ~b.palavra[1]}};
+    return r;
+}
+
+// Retorna 1 se os dois conjuntos têm alguma célula em comum (um único AND)
+static inline int bitboardTemInterseccao(Bitboard a, Bitboard b) {
+    return ((a.palavra[0] & b.palavra[0]) | (a.palavra[1] & b.palavra[1])) != 0;
+}
+
+// Retorna 1 se o conjunto não contém nenhuma célula
+static inline int bitboardEstaVazio(Bitboard a) {
+    return (a.palavra[0] | a.palavra[1]) == 0;
+}
+
+// Retorna 1 se a célula de índice informado pertence ao conjunto
+static inline int bitboardContemCelula(Bitboard a, int indice) {
+    return (int)((a.palavra[indice >> 6] >> (indice & 63)) & 1);
+}
+
+// Bitboard com as colunas marcadas em "bits" (já recortados em TAMANHO_TABULEIRO
+// bits) na linha informada; a linha pode atravessar as duas palavras
+static inline Bitboard bitboardLinha(int linha, uint64_t bits) {
+    Bitboard b = {{0, 0}};
+    int inicio = linha * TAMANHO_TABULEIRO;
+    if (inicio < 64) {
+        b.palavra[0] = bits << inicio;
+        if (inicio + TAMANHO_TABULEIRO > 64) {
+            b.palavra[1] = bits >> (64 - inicio);
+        }
+    } else {
+        b.palavra[1] = bits << (inicio - 64);
+    }
+    return b;
+}
+
+// Quantidade de células marcadas no conjunto
+static inline int bitboardContarCelulas(Bitboard a) {
+    return __builtin_popcountll(a.palavra[0]) + __builtin_popcountll(a.palavra[1]);
+}
+
+int obterDeslocamentoOrientacao(char orientacao, int *passoLinha, int *passoColuna);
+Bitboard mascaraNavio(int linha, int coluna, int tamanho, char orientacao);
+Bitboard mascaraHabilidade(int matrizHabilidade[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE],
+                           int origem_linha, int origem_coluna);
+void inicializarTabuleiroBits(TabuleiroBits *tabuleiro);
+int verificarSobreposicaoBits(const TabuleiroBits *tabuleiro,
+                              int linha, int coluna, int tamanho, char orientacao);
+void posicionarNavioBits(TabuleiroBits *tabuleiro, int linha, int coluna, char orientacao);
+void aplicarHabilidadeBits(TabuleiroBits *tabuleiro,
+                           int matrizHabilidade[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE],
+                           int origem_linha, int origem_coluna);
+void copiarTabuleiroBits(const TabuleiroBits *origem, TabuleiroBits *destino);
+int registrarTiroBits(TabuleiroBits *tabuleiro, int celula);
+void compactarTabuleiro(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                        TabuleiroBits *destino);
+void expandirTabuleiro(const TabuleiroBits *origem,
+                       int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]);
+
+// ========== HASH DE ZOBRIST ==========
+
+/*
+ * Tipo: CamadaZobrist
+ * Propósito: Conjuntos de chaves de Zobrist (uma chave de 64 bits por célula)
+ *   - ZOBRIST_NAVIOS, ZOBRIST_HABILIDADE, ZOBRIST_TIROS: camadas do TabuleiroBits
+ *   - ZOBRIST_AGUA, ZOBRIST_ACERTO: observações do atirador (hashObservacao)
+ * Nota: O hash de um conjunto de células é o XOR das chaves das células; alterar
+ *       uma célula custa um XOR, e posições alcançadas por ordens de jogadas
+ *       diferentes têm o mesmo hash.
+ */
+typedef enum {
+    ZOBRIST_NAVIOS,
+    ZOBRIST_HABILIDADE,
+    ZOBRIST_TIROS,
+    ZOBRIST_AGUA,
+    ZOBRIST_ACERTO,
+    QUANTIDADE_CAMADAS_ZOBRIST
+} CamadaZobrist;
+
+uint64_t hashCamadaZobrist(CamadaZobrist camada, Bitboard celulas);
+uint64_t hashTabuleiroBits(const TabuleiroBits *tabuleiro);
+uint64_t hashObservacao(Bitboard agua, Bitboard acertos);
+
+// ========== TABELA PRÉ-CALCULADA DE POSICIONAMENTOS ==========
+
+#define QUANTIDADE_ORIENTACOES 4  // Orientações possíveis: 'H', 'V', 'D' e 'E'
+#define MAX_POSICIONAMENTOS (CELULAS_TABULEIRO * QUANTIDADE_ORIENTACOES)  // Limite da tabela
+#define MAX_POSICIONAMENTOS_POR_CELULA (QUANTIDADE_ORIENTACOES * TAMANHO_NAVIO)  // Cobertura máxima
+
+/*
+ * Tipo: Posicionamento
+ * Propósito: Um posicionamento legal de navio de TAMANHO_NAVIO posições
+ * Campos:
+ *   - ocupacao: células ocupadas pelo navio
+ *   - halo: ocupação dilatada em uma célula nas 8 direções (inclui o próprio navio);
+ *           usada pela regra opcional de navios que não se encostam
+ *   - celulas: índices das células ocupadas, da inicial para a final
+ *   - linha, coluna: posição inicial do navio
+ *   - orientacao: 'H', 'V', 'D' ou 'E'
+ */
+typedef struct {
+    Bitboard ocupacao;
+    Bitboard halo;
+    unsigned char celulas[TAMANHO_NAVIO];
+    signed char linha;
+    signed char coluna;
+    char orientacao;
+} Posicionamento;
+
+// Orientações na ordem usada pelos índices da tabela
+extern const char ORIENTACOES[QUANTIDADE_ORIENTACOES];
+
+// Tabela de posicionamentos e índices auxiliares (preenchidos por inicializarTabelaPosicionamentos)
+extern Posicionamento tabelaPosicionamentos[MAX_POSICIONAMENTOS];
+extern int quantidadePosicionamentos;
+extern short indicePosicionamento[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO][QUANTIDADE_ORIENTACOES];
+extern short posicionamentosPorCelula[CELULAS_TABULEIRO][MAX_POSICIONAMENTOS_POR_CELULA];
+extern int quantidadePorCelula[CELULAS_TABULEIRO];
+
+// Retorna 1 se o posicionamento não cobre nenhuma célula ocupada (um único AND)
+static inline int posicionamentoLivre(const TabuleiroBits *tabuleiro, const Posicionamento *p) {
+    return !bitboardTemInterseccao(bitboardOu(tabuleiro->navios, tabuleiro->habilidade),
+                                   p->ocupacao);
+}
+
+// Retorna 1 se o posicionamento está livre e não encosta em nenhum navio, nem na diagonal
+static inline int posicionamentoLivreSemContato(const TabuleiroBits *tabuleiro,
+                                                const Posicionamento *p) {
+    return posicionamentoLivre(tabuleiro, p) &&
+           !bitboardTemInterseccao(tabuleiro->navios, p->halo);
+}
+
+void inicializarTabelaPosicionamentos(void);
+const Posicionamento *consultarPosicionamento(int linha, int coluna, char orientacao);
+const Posicionamento *buscarPosicionamentoLivre(const TabuleiroBits *tabuleiro,
+                                                int linha, int coluna, char orientacao);
+
+// ========== FORMAS DE HABILIDADE ==========
+
+#define RAIO_MAXIMO_FORMA 31                       // Lado máximo 63: cada linha cabe em 64 bits
+#define LADO_MAXIMO_FORMA (2 * RAIO_MAXIMO_FORMA + 1)
+#define RAIO_CLASSICO (TAMANHO_MATRIZ_HABILIDADE / 2)  // Raio das matrizes 7x7 (3)
+
+/*
+ * Tipo: TipoForma
+ * Propósito: Formatos de área de efeito disponíveis no registro
+ */
+typedef enum {
+    FORMA_CONE,      // Expande do topo para baixo e depois fica cheio
+    FORMA_CRUZ,      // Linha e coluna centrais
+    FORMA_OCTAEDRO,  // Losango (distância Manhattan <= raio)
+    FORMA_CIRCULO,   // Disco (distância euclidiana arredondada <= raio)
+    FORMA_ANEL,      // Borda do disco, com uma célula de espessura
+    QUANTIDADE_FORMAS
+} TipoForma;
+
+/*
+ * Tipo: FormaHabilidade
+ * Propósito: Área de efeito quadrada de lado 2 * raio + 1 em linhas de bits
+ * Campos:
+ *   - tipo, raio: identificação da forma
+ *   - tamanho: lado da forma (2 * raio + 1)
+ *   - celulas: número de posições afetadas (bits ligados em linhas)
+ *   - linhas: bit j de linhas[i] ligado = posição (i, j) afetada; pronto para
+ *             ser deslocado e combinado com OR em um bitboard
+ */
+typedef struct {
+    TipoForma tipo;
+    int raio;
+    int tamanho;
+    int celulas;
+    uint64_t linhas[LADO_MAXIMO_FORMA];
+} FormaHabilidade;
+
+// Faixa de bits [inicio, inicio + largura) ligada
+#define FAIXA_BITS(inicio, largura) ((((uint64_t)1 << (largura)) - 1) << (inicio))
+
+/*
+ * Tipo: EfeitoHabilidade
+ * Propósito: Uma habilidade a ser resolvida no turno: forma e ponto central
+ */
+typedef struct {
+    const FormaHabilidade *forma;
+    int linha;
+    int coluna;
+} EfeitoHabilidade;
+
+const FormaHabilidade *obterForma(TipoForma tipo, int raio);
+Bitboard mascaraForma(const FormaHabilidade *forma, int origem_linha, int origem_coluna);
+void aplicarFormaBits(TabuleiroBits *tabuleiro, const FormaHabilidade *forma,
+                      int origem_linha, int origem_coluna);
+void expandirForma(const FormaHabilidade *forma,
+                   int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]);
+void aplicarEfeitosBits(TabuleiroBits *tabuleiro, const EfeitoHabilidade *efeitos, int quantidade,
+                        uint32_t contagem[CELULAS_TABULEIRO]);
+
+// ========== MATRIZ TRADICIONAL 10x10 ==========
+
+void inicializarTabuleiro(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]);
+int validarPosicao(int linha, int coluna, int tamanho, char orientacao);
+int verificarSobreposicao(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                          int linha, int coluna, int tamanho, char orientacao);
+void posicionarNavio(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                     int linha, int coluna, char orientacao);
+void copiarTabuleiro(int origem[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                     int destino[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]);
+void criarMatrizCone(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]);
+void criarMatrizCruz(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]);
+void criarMatrizOctaedro(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]);
+void aplicarHabilidade(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                       int matrizHabilidade[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE],
+                       int origem_linha, int origem_coluna);
+
+// ========== SAÍDA ==========
+
+#define TAMANHO_BUFFER_TABULEIRO 512  // Comporta um tabuleiro 10x10 formatado por inteiro
+
+/*
+ * Tipo: ModoSaida
+ * Propósito: Quanto o programa escreve na saída padrão
+ *   - SAIDA_NORMAL: mensagens de progresso e tabuleiros completos
+ *   - SAIDA_SILENCIOSA: apenas mensagens de erro
+ *   - SAIDA_FLUXO: uma linha compacta por tabuleiro, para processamento de logs
+ */
+typedef enum {
+    SAIDA_NORMAL,
+    SAIDA_SILENCIOSA,
+    SAIDA_FLUXO
+} ModoSaida;
+
+void definirModoSaida(ModoSaida modo);
+#ifdef __GNUC__
+__attribute__((format(printf, 1, 2)))
+#endif
+void mensagem(const char *formato, ...);
+size_t formatarTabuleiroBits(const TabuleiroBits *tabuleiro, char *buffer);
+size_t codificarTabuleiroBits(const TabuleiroBits *tabuleiro, char *buffer);
+void exibirTabuleiroBits(const TabuleiroBits *tabuleiro);
+void exibirTabuleiro(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]);
+
+// ========== GERADOR PSEUDOALEATÓRIO REPRODUTÍVEL ==========
+
+/*
+ * Tipo: GeradorAleatorio
+ * Propósito: Estado do gerador xoshiro256** (rápido e com período 2^256 - 1)
+ * Nota: Cada thread deve ter o seu próprio gerador; a mesma semente sempre
+ *       produz a mesma sequência em qualquer plataforma.
+ */
+typedef struct {
+    uint64_t estado[4];
+} GeradorAleatorio;
+
+// Passo do splitmix64, usado apenas para espalhar a semente pelo estado
+static inline uint64_t splitmix64(uint64_t *x) {
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Rotação de 64 bits para a esquerda
+static inline uint64_t rotacionarEsquerda(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+/*
+ * Função: proximoAleatorio
+ * Propósito: Sorteia o próximo número de 64 bits da sequência
+ * Parâmetros:
+ *   - gerador: gerador já semeado
+ * Retorno: número pseudoaleatório de 64 bits
+ */
+static inline uint64_t proximoAleatorio(GeradorAleatorio *gerador) {
+    uint64_t *s = gerador->estado;
+    uint64_t resultado = rotacionarEsquerda(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotacionarEsquerda(s[3], 45);
+    return resultado;
+}
+
+/*
+ * Função: aleatorioAte
+ * Propósito: Sorteia um inteiro uniforme no intervalo [0, limite)
+ * Parâmetros:
+ *   - gerador: gerador já semeado
+ *   - limite: tamanho do intervalo (maior que zero)
+ * Retorno: inteiro sorteado sem viés de módulo (método de multiplicação de Lemire)
+ */
+static inline uint32_t aleatorioAte(GeradorAleatorio *gerador, uint32_t limite) {
+    uint64_t produto = (uint64_t)(uint32_t)(proximoAleatorio(gerador) >> 32) * limite;
+    uint32_t resto = (uint32_t)produto;
+
+    if (resto < limite) {
+        uint32_t minimo = (uint32_t)(-limite) % limite;
+        while (resto < minimo) {
+            produto = (uint64_t)(uint32_t)(proximoAleatorio(gerador) >> 32) * limite;
+            resto = (uint32_t)produto;
+        }
+    }
+    return (uint32_t)(produto >> 32);
+}
+
+void semearGerador(GeradorAleatorio *gerador, uint64_t semente);
+
+// ========== FROTAS ==========
+
+#define QUANTIDADE_NAVIOS 4  // Navios por frota, como no tabuleiro montado em main()
+
+/*
+ * Tipo: Frota
+ * Propósito: Uma frota completa e legal de QUANTIDADE_NAVIOS navios
+ * Campos:
+ *   - navios: posicionamento de cada navio (entradas da tabela de posicionamentos)
+ *   - ocupacao: união das células de todos os navios
+ */
+typedef struct {
+    const Posicionamento *navios[QUANTIDADE_NAVIOS];
+    Bitboard ocupacao;
+} Frota;
+
+/*
+ * Tipo: ModoGeracaoFrota
+ * Propósito: Estratégia de sorteio usada por gerarFrota
+ *   - FROTA_RAPIDA: sorteia de novo apenas o navio que colidiu. É a opção mais
+ *                   rápida, mas favorece levemente as frotas com menos conflitos.
+ *   - FROTA_UNIFORME: descarta a frota inteira a cada colisão. Como cada navio é
+ *                     sorteado entre todos os posicionamentos enumerados na tabela,
+ *                     toda frota legal tem exatamente a mesma probabilidade.
+ */
+typedef enum {
+    FROTA_RAPIDA,
+    FROTA_UNIFORME
+} ModoGeracaoFrota;
+
+void gerarFrota(GeradorAleatorio *gerador, ModoGeracaoFrota modo, Frota *frota);
+void posicionarFrotaBits(TabuleiroBits *tabuleiro, const Frota *frota);
+
+// ========== TABELA DE NAVIOS ==========
+
+#define MAX_NAVIOS_TABULEIRO (CELULAS_TABULEIRO / TAMANHO_NAVIO)  // 33 navios disjuntos, no máximo
+#define SEM_NAVIO 0xFF  // Entrada de navioDaCelula para células sem navio
+
+/*
+ * Tipo: NavioRastreado
+ * Propósito: Estado de um navio posicionado
+ * Campos:
+ *   - celulas: índices das células ocupadas, da inicial para a final
+ *   - ocupacao: as mesmas células em bitboard
+ *   - restantes: células ainda não atingidas (0 = afundado)
+ */
+typedef struct {
+    Bitboard ocupacao;
+    unsigned char celulas[TAMANHO_NAVIO];
+    unsigned char restantes;
+} NavioRastreado;
+
+/*
+ * Tipo: TabelaNavios
+ * Propósito: Identidade dos navios de um tabuleiro, mantida junto com os
+ *            posicionamentos para que cada tiro seja resolvido em O(1)
+ * Campos:
+ *   - navios: navios na ordem de posicionamento (o índice é o identificador)
+ *   - navioDaCelula: identificador do navio em cada célula, ou SEM_NAVIO
+ *   - quantidadeNavios: navios posicionados
+ *   - naviosRestantes: navios ainda não afundados (0 = fim de jogo)
+ */
+typedef struct {
+    NavioRastreado navios[MAX_NAVIOS_TABULEIRO];
+    unsigned char navioDaCelula[CELULAS_TABULEIRO];
+    int quantidadeNavios;
+    int naviosRestantes;
+} TabelaNavios;
+
+/*
+ * Tipo: ResultadoTiro
+ * Propósito: Efeito de um tiro resolvido pela tabela de navios
+ *   - TIRO_AGUA: nenhum navio na célula
+ *   - TIRO_ACERTO: navio atingido, mas ainda com células intactas
+ *   - TIRO_AFUNDOU: última célula intacta de um navio
+ *   - TIRO_FIM_DE_JOGO: último navio da frota afundado
+ *   - TIRO_REPETIDO: a célula já havia recebido um tiro (nada muda)
+ */
+typedef enum {
+    TIRO_AGUA,
+    TIRO_ACERTO,
+    TIRO_AFUNDOU,
+    TIRO_FIM_DE_JOGO,
+    TIRO_REPETIDO
+} ResultadoTiro;
+
+void iniciarTabelaNavios(TabelaNavios *tabela);
+int adicionarNavioRastreado(TabelaNavios *tabela, const Posicionamento *posicionamento);
+void rastrearFrota(TabelaNavios *tabela, const Frota *frota);
+ResultadoTiro resolverTiro(TabelaNavios *tabela, TabuleiroBits *tabuleiro, int celula,
+                           int *navio);
+
+// ========== MIRA POR DENSIDADE DE PROBABILIDADE (CAÇA) ==========
+
+/*
+ * Tipo: EstadoCaca
+ * Propósito: Conhecimento do atirador sobre o tabuleiro adversário, mantido de forma
+ *            incremental para que cada tiro atualize apenas os posicionamentos afetados
+ * Campos:
+ *   - agua: tiros que caíram na água
+ *   - acertos: tiros que acertaram navios
+ *   - vivo: 1 se o posicionamento ainda não cobre nenhum tiro na água
+ *   - acertosCobertos: quantidade de acertos cobertos por cada posicionamento
+ *   - densidade: quantos posicionamentos vivos cobrem cada célula
+ *   - densidadeAlvo: soma de acertosCobertos dos posicionamentos vivos que cobrem
+ *                    cada célula (puxa a mira para perto dos acertos)
+ */
+typedef struct {
+    Bitboard agua;
+    Bitboard acertos;
+    unsigned char vivo[MAX_POSICIONAMENTOS];
+    unsigned char acertosCobertos[MAX_POSICIONAMENTOS];
+    int densidade[CELULAS_TABULEIRO];
+    int densidadeAlvo[CELULAS_TABULEIRO];
+} EstadoCaca;
+
+void iniciarCaca(EstadoCaca *caca);
+void registrarTiroCaca(EstadoCaca *caca, int celula, int acerto);
+void iniciarCacaDoTabuleiro(EstadoCaca *caca, const TabuleiroBits *tabuleiro);
+int escolherAlvo(const EstadoCaca *caca);
+int dispararCaca(EstadoCaca *caca, TabuleiroBits *tabuleiro);
+
+// ========== SOLUCIONADOR EXATO ==========
+
+/*
+ * Tipo: ResultadoSolucionador
+ * Propósito: Resultado exato para as observações informadas
+ * Campos:
+ *   - total: quantidade de frotas consistentes com os tiros
+ *   - cobertura: em quantas dessas frotas cada célula tem navio
+ *   - probabilidade: cobertura / total (0 se não houver frota consistente)
+ */
+typedef struct {
+    uint64_t total;
+    uint64_t cobertura[CELULAS_TABULEIRO];
+    double probabilidade[CELULAS_TABULEIRO];
+} ResultadoSolucionador;
+
+int resolverConfiguracoes(Bitboard agua, Bitboard acertos, ResultadoSolucionador *resultado);
+
+// ========== TABELA DE TRANSPOSIÇÃO ==========
+
+/*
+ * Tipo: TabelaTransposicao
+ * Propósito: Cache de tamanho fixo, sem travas, de resultados indexados por um
+ *            hash de 64 bits. Cada entrada guarda a chave, os dados e uma versão
+ *            ("seqlock"): uma leitura concorrente com uma escrita (entrada
+ *            "rasgada") percebe a mudança de versão e é tratada como ausente.
+ * Nota: Conteúdo visível apenas em src/transposicao.c. Entradas novas sempre
+ *       substituem as antigas do mesmo índice.
+ */
+typedef struct TabelaTransposicao TabelaTransposicao;
+
+// Palavras de dados de uma entrada do cache do solucionador (total + cobertura)
+#define PALAVRAS_RESULTADO_SOLUCIONADOR (1 + CELULAS_TABULEIRO)
+
+TabelaTransposicao *criarTabelaTransposicao(size_t entradas, int palavras);
+int consultarTransposicao(const TabelaTransposicao *tabela, uint64_t chave, uint64_t *dados);
+void gravarTransposicao(TabelaTransposicao *tabela, uint64_t chave, const uint64_t *dados);
+void limparTabelaTransposicao(TabelaTransposicao *tabela);
+int palavrasTabelaTransposicao(const TabelaTransposicao *tabela);
+void destruirTabelaTransposicao(TabelaTransposicao *tabela);
+int resolverConfiguracoesEmCache(TabelaTransposicao *cache, Bitboard agua, Bitboard acertos,
+                                 ResultadoSolucionador *resultado);
+int semearCacheSolucionador(TabelaTransposicao *cache, const ResultadoSolucionador *priori);
+
+// ========== VISÃO DO ATACANTE ==========
+
+#define TAMANHO_BUFFER_VISAO 512  // Comporta uma visão 10x10 formatada por inteiro
+
+/*
+ * Tipo: CamadaHabilidade
+ * Propósito: Área de habilidade internada: visões com a mesma área apontam para a
+ *            mesma camada, criada e liberada pelo RegistroCamadas
+ * Campos:
+ *   - celulas: células da área
+ *   - hash: hashCamadaZobrist(ZOBRIST_HABILIDADE, celulas)
+ *   - referencias: visões que usam a camada (alterado só com a trava do registro)
+ *   - proxima: próxima camada do mesmo balde do registro
+ * Nota: Somente leitura fora de src/visao.c. Duas camadas internadas no mesmo
+ *       registro são iguais se e somente se os ponteiros forem iguais.
+ */
+typedef struct CamadaHabilidade {
+    Bitboard celulas;
+    uint64_t hash;
+    uint32_t referencias;
+    struct CamadaHabilidade *proxima;
+} CamadaHabilidade;
+
+// Registro opaco de camadas internadas (conteúdo visível apenas em src/visao.c)
+typedef struct RegistroCamadas RegistroCamadas;
+
+/*
+ * Tipo: ValorVisao
+ * Propósito: O que o atacante sabe de uma célula do tabuleiro adversário
+ *   - VISAO_DESCONHECIDA: ainda não recebeu tiro
+ *   - VISAO_AGUA: tiro que caiu na água (ou em área de habilidade)
+ *   - VISAO_ACERTO: tiro que acertou um navio
+ *   - VISAO_PREVIA: sem tiro, dentro da área de habilidade em pré-visualização
+ */
+typedef enum {
+    VISAO_DESCONHECIDA,
+    VISAO_AGUA,
+    VISAO_ACERTO,
+    VISAO_PREVIA
+} ValorVisao;
+
+/*
+ * Tipo: VisaoAtacante
+ * Propósito: Tabuleiro adversário como o atacante o enxerga, sem matriz própria:
+ *            cada célula é derivada na hora das camadas apontadas
+ * Campos:
+ *   - navios: camada de navios do defensor (compartilhada, nunca copiada)
+ *   - tiros: camada de tiros do atacante contra esse defensor
+ *   - previa: área em pré-visualização (internada), ou NULL
+ * Nota: Ocupa 24 bytes, contra 400 da matriz int[10][10]. Como só guarda
+ *       ponteiros, todo tiro registrado nas camadas já aparece na visão, sem
+ *       nenhuma atualização. As camadas apontadas devem viver mais que a visão.
+ */
+typedef struct {
+    const Bitboard *navios;
+    const Bitboard *tiros;
+    const CamadaHabilidade *previa;
+} VisaoAtacante;
+
+/*
+ * Função: consultarVisao
+ * Propósito: Valor de uma célula da visão, calculado sob demanda
+ * Parâmetros:
+ *   - visao: visão do atacante
+ *   - celula: índice da célula (INDICE_CELULA)
+ * Retorno: ValorVisao da célula; o resultado de um tiro prevalece sobre a prévia
+ */
+static inline ValorVisao consultarVisao(const VisaoAtacante *visao, int celula) {
+    if (bitboardContemCelula(*visao->tiros, celula)) {
+        return bitboardContemCelula(*visao->navios, celula) ? VISAO_ACERTO : VISAO_AGUA;
+    }
+    if (visao->previa != NULL && bitboardContemCelula(visao->previa->celulas, celula)) {
+        return VISAO_PREVIA;
+    }
+    return VISAO_DESCONHECIDA;
+}
+
+RegistroCamadas *criarRegistroCamadas(void);
+const CamadaHabilidade *internarCamadaHabilidade(RegistroCamadas *registro, Bitboard celulas);
+void reterCamadaHabilidade(RegistroCamadas *registro, const CamadaHabilidade *camada);
+void soltarCamadaHabilidade(RegistroCamadas *registro, const CamadaHabilidade *camada);
+size_t quantidadeCamadasInternadas(RegistroCamadas *registro);
+void destruirRegistroCamadas(RegistroCamadas *registro);
+void iniciarVisaoAtacante(VisaoAtacante *visao, const Bitboard *navios, const Bitboard *tiros);
+int previsualizarFormaVisao(VisaoAtacante *visao, RegistroCamadas *registro,
+                            const FormaHabilidade *forma, int origem_linha, int origem_coluna);
+void limparPreviaVisao(VisaoAtacante *visao, RegistroCamadas *registro);
+Bitboard celulasVisao(const VisaoAtacante *visao, ValorVisao valor);
+size_t formatarVisao(const VisaoAtacante *visao, char *buffer);
+
+// ========== SIMULADOR DE MONTE CARLO ==========
+
+/*
+ * Tipo: PoliticaTiro
+ * Propósito: Estratégia usada pelo atirador nas partidas simuladas
+ *   - POLITICA_ALEATORIA: atira em ordem aleatória, sem repetir células
+ *   - POLITICA_CACA: atira no máximo da densidade de probabilidade (EstadoCaca)
+ */
+typedef enum {
+    POLITICA_ALEATORIA,
+    POLITICA_CACA
+} PoliticaTiro;
+
+/*
+ * Tipo: ConfiguracaoSimulacao
+ * Campos:
+ *   - partidas: quantidade total de partidas a simular
+ *   - threads: threads de trabalho (0 usa todos os núcleos disponíveis)
+ *   - semente: semente base; cada thread deriva a sua própria a partir dela
+ *   - politica: estratégia de tiro
+ *   - modoFrota: modo de sorteio das frotas (FROTA_RAPIDA ou FROTA_UNIFORME)
+ */
+typedef struct {
+    long long partidas;
+    int threads;
+    uint64_t semente;
+    PoliticaTiro politica;
+    ModoGeracaoFrota modoFrota;
+} ConfiguracaoSimulacao;
+
+/*
+ * Tipo: ResultadoSimulacao
+ * Campos:
+ *   - partidas: partidas simuladas
+ *   - histograma: histograma[n] = partidas vencidas com exatamente n tiros
+ *   - mediaTiros: média de tiros até afundar a frota inteira
+ *   - segundos: tempo total de parede da simulação
+ *   - partidasPorSegundo: vazão obtida
+ *   - threadsUsadas: threads de trabalho efetivamente criadas
+ */
+typedef struct {
+    long long partidas;
+    long long histograma[CELULAS_TABULEIRO + 1];
+    double mediaTiros;
+    double segundos;
+    double partidasPorSegundo;
+    int threadsUsadas;
+} ResultadoSimulacao;
+
+int jogarPartidaRegistrada(GeradorAleatorio *gerador, PoliticaTiro politica,
+                           ModoGeracaoFrota modoFrota, TabuleiroBits *tabuleiro,
+                           unsigned char sequencia[CELULAS_TABULEIRO]);
+int jogarPartida(GeradorAleatorio *gerador, PoliticaTiro politica, ModoGeracaoFrota modoFrota);
+int simularPartidas(const ConfiguracaoSimulacao *configuracao, ResultadoSimulacao *resultado);
+
+// ========== TABULEIRO COM DIMENSÕES DEFINIDAS EM TEMPO DE EXECUÇÃO ==========
+
+#define MAX_NAVIOS_FROTA 64         // Limite de navios em uma especificação de frota
+
+/*
+ * Tipo: TabuleiroDinamico
+ * Propósito: Tabuleiro de largura e altura quaisquer (mapas grandes, frotas mistas)
+ * Campos:
+ *   - largura, altura: dimensões do tabuleiro
+ *   - passo: bytes por linha no buffer (largura arredondada para múltiplo de 64)
+ *   - celulas: buffer contíguo de altura * passo bytes, alinhado à linha de cache,
+ *              com valores AGUA, NAVIO ou HABILIDADE
+ *   - arena: arena que contém o buffer, ou NULL se o buffer pertence ao tabuleiro
+ * Nota: O tabuleiro clássico 10x10 continua usando TabuleiroBits, que é mais rápido.
+ */
+typedef struct {
+    int largura;
+    int altura;
+    int passo;
+    unsigned char *celulas;
+    Arena *arena;
+} TabuleiroDinamico;
+
+/*
+ * Tipo: EspecificacaoFrota
+ * Propósito: Composição de uma frota com navios de tamanhos diferentes
+ * Campos:
+ *   - quantidade: número de navios
+ *   - tamanhos: tamanho de cada navio
+ */
+typedef struct {
+    int quantidade;
+    int tamanhos[MAX_NAVIOS_FROTA];
+} EspecificacaoFrota;
+
+/*
+ * Tipo: MatrizHabilidadeDinamica
+ * Propósito: Área de efeito quadrada de lado ímpar qualquer
+ * Campos:
+ *   - tamanho: lado da matriz
+ *   - celulas: tamanho * tamanho bytes, linha a linha, com 1 nas posições afetadas
+ */
+typedef struct {
+    int tamanho;
+    const unsigned char *celulas;
+} MatrizHabilidadeDinamica;
+
+// Endereço da célula (linha, coluna) no buffer do tabuleiro
+static inline unsigned char *celulaDinamica(const TabuleiroDinamico *tabuleiro,
+                                            int linha, int coluna) {
+    return tabuleiro->celulas + (size_t)linha * (size_t)tabuleiro->passo + (size_t)coluna;
+}
+
+/*
+ * Tipo: KernelHabilidade
+ * Propósito: Implementação usada para carimbar uma linha da matriz de habilidade.
+ *            Todas produzem exatamente o mesmo resultado.
+ */
+typedef enum {
+    KERNEL_AUTOMATICO,  // Melhor kernel suportado pela CPU (detectado uma única vez)
+    KERNEL_ESCALAR,
+    KERNEL_SSE2,
+    KERNEL_AVX2
+} KernelHabilidade;
+
+int criarTabuleiroDinamico(TabuleiroDinamico *tabuleiro, int largura, int altura);
+int criarTabuleiroDinamicoNaArena(TabuleiroDinamico *tabuleiro, Arena *arena,
+                                  int largura, int altura);
+void liberarTabuleiroDinamico(TabuleiroDinamico *tabuleiro);
+void inicializarTabuleiroDinamico(TabuleiroDinamico *tabuleiro);
+int copiarTabuleiroDinamico(const TabuleiroDinamico *origem, TabuleiroDinamico *destino);
+int validarPosicaoDinamico(const TabuleiroDinamico *tabuleiro,
+                           int linha, int coluna, int tamanho, char orientacao);
+int verificarSobreposicaoDinamico(const TabuleiroDinamico *tabuleiro,
+                                  int linha, int coluna, int tamanho, char orientacao);
+void posicionarNavioDinamico(TabuleiroDinamico *tabuleiro,
+                             int linha, int coluna, int tamanho, char orientacao);
+KernelHabilidade obterKernelHabilidade(void);
+void aplicarHabilidadeDinamicoComKernel(TabuleiroDinamico *tabuleiro,
+                                        const MatrizHabilidadeDinamica *matriz,
+                                        int origem_linha, int origem_coluna,
+                                        KernelHabilidade kernel);
+void aplicarHabilidadeDinamico(TabuleiroDinamico *tabuleiro, const MatrizHabilidadeDinamica *matriz,
+                               int origem_linha, int origem_coluna);
+void aplicarFormaDinamico(TabuleiroDinamico *tabuleiro, const FormaHabilidade *forma,
+                          int origem_linha, int origem_coluna);
+void aplicarEfeitosDinamico(TabuleiroDinamico *tabuleiro, const EfeitoHabilidade *efeitos,
+                            int quantidade, uint32_t *contagem);
+EspecificacaoFrota especificacaoFrotaClassica(void);
+int posicionarFrotaDinamica(TabuleiroDinamico *tabuleiro, const EspecificacaoFrota *especificacao,
+                            GeradorAleatorio *gerador);
+int compactarTabuleiroDinamico(const TabuleiroDinamico *origem, TabuleiroBits *destino);
+
+// ========== HISTÓRICO PARA DESFAZER JOGADAS ==========
+
+/*
+ * Tipo: DeltaTabuleiro
+ * Propósito: Uma jogada desfazível no tabuleiro em bits, guardada como a diferença
+ *            (XOR) de cada camada; aplicar o XOR de novo restaura o estado anterior
+ * Campos:
+ *   - navios, habilidade, tiros: bits alterados em cada camada
+ *   - hash: diferença (XOR) do hash de Zobrist do tabuleiro
+ *   - navio: navio da tabela atingido pelo tiro (-1 se nenhum)
+ *   - navioAdicionado: 1 se a jogada registrou um navio na tabela de navios
+ */
+typedef struct {
+    Bitboard navios;
+    Bitboard habilidade;
+    Bitboard tiros;
+    uint64_t hash;
+    signed char navio;
+    unsigned char navioAdicionado;
+} DeltaTabuleiro;
+
+/*
+ * Tipo: HistoricoTabuleiro
+ * Propósito: Pilha de jogadas desfazíveis sobre um TabuleiroBits (e, opcionalmente,
+ *            a sua TabelaNavios). Uma marca é apenas o tamanho da pilha, então
+ *            "tirar um instantâneo" não copia nada e voltar custa uma operação
+ *            por jogada desfeita.
+ * Campos:
+ *   - deltas: memória da pilha, fornecida por quem cria o histórico
+ *   - quantidade, capacidade: ocupação da pilha
+ */
+typedef struct {
+    DeltaTabuleiro *deltas;
+    int quantidade;
+    int capacidade;
+} HistoricoTabuleiro;
+
+/*
+ * Tipo: AlteracaoCelula
+ * Propósito: Valor anterior de uma célula de tabuleiro dinâmico
+ */
+typedef struct {
+    size_t deslocamento;     // Posição da célula no buffer (linha * passo + coluna)
+    unsigned char anterior;  // Valor antes da jogada
+} AlteracaoCelula;
+
+/*
+ * Tipo: HistoricoDinamico
+ * Propósito: Registro das células alteradas em um TabuleiroDinamico; desfazer
+ *            custa uma escrita por célula alterada, nunca uma cópia do tabuleiro
+ * Campos:
+ *   - alteracoes: memória do registro, fornecida por quem cria o histórico
+ *   - quantidade, capacidade: ocupação do registro
+ */
+typedef struct {
+    AlteracaoCelula *alteracoes;
+    size_t quantidade;
+    size_t capacidade;
+} HistoricoDinamico;
+
+void iniciarHistoricoTabuleiro(HistoricoTabuleiro *historico, DeltaTabuleiro *deltas,
+                               int capacidade);
+int posicionarNavioDesfazivel(HistoricoTabuleiro *historico, TabuleiroBits *tabuleiro,
+                              TabelaNavios *navios, const Posicionamento *posicionamento);
+int aplicarFormaDesfazivel(HistoricoTabuleiro *historico, TabuleiroBits *tabuleiro,
+                           const FormaHabilidade *forma, int origem_linha, int origem_coluna);
+int aplicarHabilidadeDesfazivel(HistoricoTabuleiro *historico, TabuleiroBits *tabuleiro,
+                                int matrizHabilidade[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE],
+                                int origem_linha, int origem_coluna);
+int atirarDesfazivel(HistoricoTabuleiro *historico, TabuleiroBits *tabuleiro,
+                     TabelaNavios *navios, int celula);
+void voltarHistoricoTabuleiro(HistoricoTabuleiro *historico, TabuleiroBits *tabuleiro,
+                              TabelaNavios *navios, int marca);
+void iniciarHistoricoDinamico(HistoricoDinamico *historico, AlteracaoCelula *alteracoes,
+                              size_t capacidade);
+int posicionarNavioDinamicoDesfazivel(HistoricoDinamico *historico, TabuleiroDinamico *tabuleiro,
+                                      int linha, int coluna, int tamanho, char orientacao);
+int aplicarFormaDinamicoDesfazivel(HistoricoDinamico *historico, TabuleiroDinamico *tabuleiro,
+                                   const FormaHabilidade *forma,
+                                   int origem_linha, int origem_coluna);
+void voltarHistoricoDinamico(HistoricoDinamico *historico, TabuleiroDinamico *tabuleiro,
+                             size_t marca);
+
+// ========== PARTIDAS EM ARENA ==========
+
+/*
+ * Tipo: PartidaDinamica
+ * Propósito: Uma partida inteira (tabuleiro, frota, tiros e histórico de jogadas)
+ *            alocada de uma só vez em uma arena e descartada em O(1)
+ * Campos:
+ *   - arena, marca: arena de origem e posição dela antes da partida
+ *   - tabuleiro: tabuleiro dinâmico com o buffer na arena
+ *   - frota: cópia da especificação da frota
+ *   - atingidas: um bit por célula (linha * largura + coluna) já atingida
+ *   - celulasRestantes: células de navio ainda não atingidas (0 = frota afundada)
+ *   - tiros: histórico de tiros, como índices linha * largura + coluna
+ *   - efeitos: histórico de efeitos de habilidade aplicados
+ *   - quantidadeTiros, quantidadeEfeitos, capacidadeEfeitos: ocupação dos históricos
+ *     (cabem largura * altura tiros, um por célula)
+ */
+typedef struct {
+    Arena *arena;
+    MarcaArena marca;
+    TabuleiroDinamico tabuleiro;
+    EspecificacaoFrota *frota;
+    uint64_t *atingidas;
+    long celulasRestantes;
+    uint32_t *tiros;
+    long quantidadeTiros;
+    EfeitoHabilidade *efeitos;
+    int quantidadeEfeitos;
+    int capacidadeEfeitos;
+} PartidaDinamica;
+
+int iniciarPartidaDinamica(PartidaDinamica *partida, Arena *arena, int largura, int altura,
+                           const EspecificacaoFrota *frota, int capacidadeEfeitos);
+int posicionarFrotaPartida(PartidaDinamica *partida, GeradorAleatorio *gerador);
+int aplicarEfeitoPartida(PartidaDinamica *partida, const EfeitoHabilidade *efeito);
+int registrarTiroPartida(PartidaDinamica *partida, int linha, int coluna);
+void encerrarPartidaDinamica(PartidaDinamica *partida);
+long jogarPartidaDinamica(GeradorAleatorio *gerador, Arena *arena, int largura, int altura,
+                          const EspecificacaoFrota *frota);
+
+// ========== REGISTRO BINÁRIO DE PARTIDAS ==========
+
+#define BYTES_OCUPACAO ((CELULAS_TABULEIRO + 7) / 8)  // 100 bits em 13 bytes
+
+/*
+ * Tipo: EscritorRegistros
+ * Propósito: Arquivo de registros aberto para gravação
+ */
+typedef struct {
+    FILE *arquivo;
+    char *buffer;  // Buffer de escrita grande: o arquivo é gravado em blocos
+} EscritorRegistros;
+
+/*
+ * Tipo: LeitorRegistros
+ * Propósito: Arquivo de registros mapeado em memória para leitura sequencial
+ */
+typedef struct {
+    const unsigned char *dados;
+    size_t tamanho;
+    size_t posicao;
+#ifdef _WIN32
+    HANDLE arquivo;
+    HANDLE mapeamento;
+#else
+    int descritor;
+#endif
+} LeitorRegistros;
+
+/*
+ * Tipo: RegistroPartida
+ * Propósito: Uma partida lida do arquivo; todos os ponteiros apontam para o
+ *            próprio mapeamento e valem até fecharLeitorRegistros
+ * Campos:
+ *   - ocupacao: BYTES_OCUPACAO bytes com a camada de navios
+ *   - tiros: células atingidas, um byte por tiro
+ *   - quantidadeTiros: tamanho de tiros
+ *   - efeitos: efeitos codificados (ler um a um com lerEfeitoRegistrado)
+ *   - quantidadeEfeitos: quantidade de efeitos
+ *   - fim: primeiro byte após a partida
+ */
+typedef struct {
+    const unsigned char *ocupacao;
+    const unsigned char *tiros;
+    int quantidadeTiros;
+    const unsigned char *efeitos;
+    int quantidadeEfeitos;
+    const unsigned char *fim;
+} RegistroPartida;
+
+void empacotarOcupacao(Bitboard camada, unsigned char destino[BYTES_OCUPACAO]);
+Bitboard desempacotarOcupacao(const unsigned char origem[BYTES_OCUPACAO]);
+int abrirEscritorRegistros(EscritorRegistros *escritor, const char *caminho);
+int gravarPartida(EscritorRegistros *escritor, Bitboard navios, const unsigned char *tiros,
+                  int quantidadeTiros, const EfeitoHabilidade *efeitos, int quantidadeEfeitos);
+int fecharEscritorRegistros(EscritorRegistros *escritor);
+void fecharLeitorRegistros(LeitorRegistros *leitor);
+int abrirLeitorRegistros(LeitorRegistros *leitor, const char *caminho);
+int proximaPartida(LeitorRegistros *leitor, RegistroPartida *partida);
+int lerEfeitoRegistrado(const unsigned char **cursor, const unsigned char *fim,
+                        EfeitoHabilidade *efeito);
+
+// ========== POOL DE TRABALHO COM ROUBO DE TAREFAS ==========
+
+/*
+ * Tipo: PoolTrabalho
+ * Propósito: Threads de trabalho, cada uma com a sua fila dupla de tarefas. A dona
+ *            empilha e desempilha pelo fim da fila; as threads ociosas roubam pelo
+ *            início da fila das outras. Tarefas enviadas de dentro de uma tarefa vão
+ *            para a fila da própria thread (sem disputa e com a cache já aquecida).
+ * Nota: Conteúdo visível apenas em src/pool_trabalho.c
+ */
+typedef struct PoolTrabalho PoolTrabalho;
+
+// Tarefa executada pelo pool
+typedef void (*FuncaoTarefa)(void *argumento);
+
+PoolTrabalho *criarPoolTrabalho(int threads);
+int enviarTarefa(PoolTrabalho *pool, FuncaoTarefa funcao, void *argumento);
+void aguardarPoolTrabalho(PoolTrabalho *pool);
+int threadsPoolTrabalho(const PoolTrabalho *pool);
+long long roubosPoolTrabalho(const PoolTrabalho *pool);
+void destruirPoolTrabalho(PoolTrabalho *pool);
+
+// ========== ENUMERAÇÃO EXAUSTIVA DE LAYOUTS ==========
+
+#define NAVIOS_LAYOUT 4  // Frota do main(): quatro navios de TAMANHO_NAVIO posições
+#define PALAVRAS_CONJUNTO_POSICIONAMENTOS ((MAX_POSICIONAMENTOS + 63) / 64)
+
+/*
+ * Tipo: EnumeracaoLayouts
+ * Propósito: Todos os layouts legais da frota (conjuntos de NAVIOS_LAYOUT
+ *            posicionamentos sem células em comum), contados e numerados
+ * Campos:
+ *   - total: quantidade de layouts
+ *   - frequencia: em quantos layouts cada célula tem navio
+ *   - porPosicionamento: em quantos layouts cada posicionamento aparece
+ *   - roubos: tarefas roubadas entre as threads durante a enumeração
+ *   - quantidade: posicionamentos da tabela (quantidadePosicionamentos)
+ *   - acumuladoPrimeiro: layouts cujo primeiro navio vem antes de cada índice
+ *                        (quantidade + 1 entradas)
+ *   - acumuladoPar: para o primeiro navio p e o segundo s, layouts de p cujo
+ *                   segundo navio vem antes de s (índice p * quantidade + s)
+ *   - compativeis: para cada posicionamento, os que não têm células em comum com ele
+ * Nota: Um layout é representado pelos índices dos seus navios na tabela de
+ *       posicionamentos, em ordem crescente; a numeração segue a ordem
+ *       lexicográfica desses índices, de 0 a total - 1.
+ */
+typedef struct {
+    uint64_t total;
+    uint64_t frequencia[CELULAS_TABULEIRO];
+    uint64_t porPosicionamento[MAX_POSICIONAMENTOS];
+    long long roubos;
+    int quantidade;
+    uint64_t *acumuladoPrimeiro;
+    uint64_t *acumuladoPar;
+    uint64_t (*compativeis)[PALAVRAS_CONJUNTO_POSICIONAMENTOS];
+} EnumeracaoLayouts;
+
+int enumerarLayouts(EnumeracaoLayouts *enumeracao, int threads);
+uint64_t posicaoLayout(const EnumeracaoLayouts *enumeracao, const short navios[NAVIOS_LAYOUT]);
+int layoutNaPosicao(const EnumeracaoLayouts *enumeracao, uint64_t posicao,
+                    short navios[NAVIOS_LAYOUT]);
+void prioriDaEnumeracao(const EnumeracaoLayouts *enumeracao, ResultadoSolucionador *priori);
+int gravarPriori(const char *caminho, const ResultadoSolucionador *priori);
+int carregarPriori(const char *caminho, ResultadoSolucionador *priori);
+void liberarEnumeracaoLayouts(EnumeracaoLayouts *enumeracao);
+
+// ========== SERVIDOR DE PARTIDAS ==========
+
+#define CAPACIDADE_FILA_JOGADAS 128  // Jogadas pendentes por partida
+#define BITS_FRAGMENTO 6             // 64 fragmentos de partidas
+#define QUANTIDADE_FRAGMENTOS (1 << BITS_FRAGMENTO)
+
+/*
+ * Tipo: TipoJogada
+ * Propósito: Ações aceitas pelo servidor
+ *   - JOGADA_POSICIONAR: posiciona um navio (linha, coluna, orientacao)
+ *   - JOGADA_HABILIDADE: aplica uma área de efeito (forma, raio, linha, coluna)
+ *   - JOGADA_SORTEAR_FROTA: substitui o tabuleiro por uma frota uniforme (semente)
+ *   - JOGADA_TIRO: atira em (linha, coluna); o primeiro tiro encerra a preparação
+ *   - JOGADA_PREVIA: mostra na visão do atacante a área (forma, raio, linha, coluna),
+ *                    sem alterar o tabuleiro; aceita em qualquer fase da partida ativa
+ */
+typedef enum {
+    JOGADA_POSICIONAR,
+    JOGADA_HABILIDADE,
+    JOGADA_SORTEAR_FROTA,
+    JOGADA_TIRO,
+    JOGADA_PREVIA
+} TipoJogada;
+
+/*
+ * Tipo: Jogada
+ * Campos:
+ *   - tipo: ação desejada
+ *   - linha, coluna: célula do navio, do centro da habilidade ou do tiro
+ *   - orientacao: 'H', 'V', 'D' ou 'E' (JOGADA_POSICIONAR)
+ *   - forma, raio: TipoForma e raio da área (JOGADA_HABILIDADE e JOGADA_PREVIA)
+ *   - semente: semente da frota (JOGADA_SORTEAR_FROTA)
+ */
+typedef struct {
+    TipoJogada tipo;
+    signed char linha;
+    signed char coluna;
+    char orientacao;
+    unsigned char forma;
+    unsigned char raio;
+    uint64_t semente;
+} Jogada;
+
+/*
+ * Tipo: ResultadoJogada
+ * Propósito: Resposta às jogadas que não são tiros (tiros aceitos respondem com
+ *            ResultadoTiro). Valores negativos indicam jogada recusada.
+ */
+typedef enum {
+    JOGADA_FORA_DE_FASE = -4,      // Preparação já encerrada, partida encerrada ou tiro sem frota
+    JOGADA_SOBREPOSICAO = -3,      // Navio cobre navio ou área de habilidade
+    JOGADA_POSICAO_INVALIDA = -2,  // Navio ultrapassa os limites do tabuleiro
+    JOGADA_INVALIDA = -1,          // Tipo, célula, forma ou raio inválidos
+    JOGADA_ACEITA = 0
+} ResultadoJogada;
+
+/*
+ * Tipo: FasePartida
+ *   - PARTIDA_PREPARACAO: aceita navios, habilidades e frotas sorteadas
+ *   - PARTIDA_EM_ANDAMENTO: aceita apenas tiros
+ *   - PARTIDA_ENCERRADA: todos os navios afundados; recusa qualquer jogada
+ */
+typedef enum {
+    PARTIDA_PREPARACAO,
+    PARTIDA_EM_ANDAMENTO,
+    PARTIDA_ENCERRADA
+} FasePartida;
+
+/*
+ * Tipo: EstadoPartida
+ * Propósito: Cópia do estado de uma partida, obtida com consultarPartida
+ * Nota: A visão do atacante sai de iniciarVisaoAtacante(&visao, &tabuleiro.navios,
+ *       &tabuleiro.tiros); previa traz as células da prévia de habilidade atual.
+ */
+typedef struct {
+    FasePartida fase;
+    int tiros;
+    int naviosRestantes;
+    TabuleiroBits tabuleiro;
+    Bitboard previa;
+} EstadoPartida;
+
+/*
+ * Tipo: RespostaJogada
+ * Propósito: Chamada pelo servidor, na thread de trabalho, para cada jogada resolvida.
+ *            As respostas de uma mesma partida nunca são simultâneas e chegam na
+ *            ordem das jogadas; a função pode enviar novas jogadas.
+ * Parâmetros:
+ *   - contexto: ponteiro informado em criarPartida
+ *   - partida: identificador da partida
+ *   - jogada: jogada resolvida
+ *   - resultado: ResultadoTiro (tiros aceitos) ou ResultadoJogada
+ */
+typedef void (*RespostaJogada)(void *contexto, uint64_t partida, const Jogada *jogada,
+                               int resultado);
+
+/*
+ * Tipo: ConfiguracaoServidor
+ * Campos:
+ *   - threads: threads de trabalho (0 usa todos os núcleos disponíveis)
+ *   - aoResolver: resposta de cada jogada; pode ser NULL
+ */
+typedef struct {
+    int threads;
+    RespostaJogada aoResolver;
+} ConfiguracaoServidor;
+
+// Servidor opaco (conteúdo visível apenas em src/servidor.c)
+typedef struct ServidorPartidas ServidorPartidas;
+
+ServidorPartidas *criarServidorPartidas(const ConfiguracaoServidor *configuracao);
+int criarPartida(ServidorPartidas *servidor, void *contexto, uint64_t *partida);
+int enviarJogadas(ServidorPartidas *servidor, uint64_t partida, const Jogada *jogadas,
+                  int quantidade);
+int consultarPartida(ServidorPartidas *servidor, uint64_t partida, EstadoPartida *estado);
+void aguardarServidor(ServidorPartidas *servidor);
+const PoolTrabalho *poolServidor(const ServidorPartidas *servidor);
+void destruirServidorPartidas(ServidorPartidas *servidor);
+
+#endif  // BATALHA_NAVAL_INTERNO_H
@@ -0,0 +1,141 @@
+/*
+ * Arquivo: src/caca.c
+ * Descrição: Mira por densidade de probabilidade (caça)
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== MIRA POR DENSIDADE DE PROBABILIDADE (CAÇA) ==========
+
+#define PESO_ACERTO 64  // Peso de cada acerto coberto por um posicionamento ainda possível
+
+/*
+ * Função: iniciarCaca
+ * Propósito: Prepara o estado da caça para um tabuleiro sem nenhum tiro
+ * Parâmetros:
+ *   - caca: estado a ser inicializado
+ * Retorno: void (não retorna valor)
+ */
+void iniciarCaca(EstadoCaca *caca) {
+    inicializarTabelaPosicionamentos();
+
+    caca->agua = bitboardVazio();
+    caca->acertos = bitboardVazio();
+    for (int p = 0; p < quantidadePosicionamentos; p++) {
+        caca->vivo[p] = 1;
+        caca->acertosCobertos[p] = 0;
+    }
+    // Sem tiros, a densidade de cada célula é o número de posicionamentos que a cobrem
+    for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+        caca->densidade[c] = quantidadePorCelula[c];
+        caca->densidadeAlvo[c] = 0;
+    }
+}
+
+/*
+ * Função: registrarTiroCaca
+ * Propósito: Atualiza as densidades após um tiro, visitando apenas os
+ *            posicionamentos que cobrem a célula atingida (no máximo 12)
+ * Parâmetros:
+ *   - caca: estado da caça
+ *   - celula: índice da célula atingida
+ *   - acerto: 1 se o tiro acertou um navio, 0 se caiu na água
+ * Retorno: void (não retorna valor)
+ * Nota: Um tiro repetido em uma célula já registrada é ignorado, como
+ *       TIRO_REPETIDO em resolverTiro; contá-lo de novo descontaria os mesmos
+ *       posicionamentos duas vezes.
+ */
+void registrarTiroCaca(EstadoCaca *caca, int celula, int acerto) {
+    if (bitboardContemCelula(bitboardOu(caca->agua, caca->acertos), celula)) {
+        return;
+    }
+    if (acerto) {
+        caca->acertos = bitboardOu(caca->acertos, bitboardCelula(celula));
+    } else {
+        caca->agua = bitboardOu(caca->agua, bitboardCelula(celula));
+    }
+
+    for (int k = 0; k < quantidadePorCelula[celula]; k++) {
+        int indice = posicionamentosPorCelula[celula][k];
+        const Posicionamento *p = &tabelaPosicionamentos[indice];
+
+        if (!caca->vivo[indice]) {
+            continue;  // Já descartado por outro tiro na água
+        }
+
+        if (acerto) {
+            // O posicionamento ganha mais um acerto: reforça todas as suas células
+            caca->acertosCobertos[indice]++;
+            for (int n = 0; n < TAMANHO_NAVIO; n++) {
+                caca->densidadeAlvo[p->celulas[n]]++;
+            }
+        } else {
+            // Tiro na água elimina o posicionamento e tudo que ele contribuía
+            caca->vivo[indice] = 0;
+            for (int n = 0; n < TAMANHO_NAVIO; n++) {
+                caca->densidade[p->celulas[n]]--;
+                caca->densidadeAlvo[p->celulas[n]] -= caca->acertosCobertos[indice];
+            }
+        }
+    }
+}
+
+/*
+ * Função: iniciarCacaDoTabuleiro
+ * Propósito: Monta o estado da caça a partir dos tiros já registrados no tabuleiro
+ * Parâmetros:
+ *   - caca: estado a ser preenchido
+ *   - tabuleiro: tabuleiro cujos acertos (tiros & navios) e tiros na água serão lidos
+ * Retorno: void (não retorna valor)
+ */
+void iniciarCacaDoTabuleiro(EstadoCaca *caca, const TabuleiroBits *tabuleiro) {
+    iniciarCaca(caca);
+    for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+        if (bitboardContemCelula(tabuleiro->tiros, c)) {
+            registrarTiroCaca(caca, c, bitboardContemCelula(tabuleiro->navios, c));
+        }
+    }
+}
+
+/*
+ * Função: escolherAlvo
+ * Propósito: Escolhe a célula ainda não atingida com maior pontuação
+ *            (densidade + PESO_ACERTO * densidadeAlvo)
+ * Parâmetros:
+ *   - caca: estado da caça
+ * Retorno: índice da célula escolhida, ou -1 se todas já foram atingidas
+ * Nota: Empates são resolvidos pela menor célula, o que mantém o jogo reprodutível
+ */
+int escolherAlvo(const EstadoCaca *caca) {
+    Bitboard atingidas = bitboardOu(caca->agua, caca->acertos);
+    int melhor = -1;
+    long melhorPontuacao = -1;
+
+    for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+        if (bitboardContemCelula(atingidas, c)) {
+            continue;
+        }
+        long pontuacao = caca->densidade[c] + (long)PESO_ACERTO * caca->densidadeAlvo[c];
+        if (pontuacao > melhorPontuacao) {
+            melhorPontuacao = pontuacao;
+            melhor = c;
+        }
+    }
+    return melhor;
+}
+
+/*
+ * Função: dispararCaca
+ * Propósito: Escolhe o melhor alvo, atira no tabuleiro e atualiza a caça
+ * Parâmetros:
+ *   - caca: estado da caça
+ *   - tabuleiro: tabuleiro adversário
+ * Retorno: índice da célula atingida, ou -1 se não houver mais alvos
+ */
+int dispararCaca(EstadoCaca *caca, TabuleiroBits *tabuleiro) {
+    int alvo = escolherAlvo(caca);
+    if (alvo >= 0) {
+        registrarTiroCaca(caca, alvo, registrarTiroBits(tabuleiro, alvo));
+    }
+    return alvo;
+}
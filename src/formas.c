@@ -0,0 +1,241 @@
+/*
+ * Arquivo: src/formas.c
+ * Descrição: Registro de formas de habilidade e aplicação de efeitos em lote
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== REGISTRO DE FORMAS DE HABILIDADE ==========
+
+// Linha i das formas com fórmula fechada (expressões constantes, avaliadas na compilação)
+#define LINHA_CONE(raio, i) \
+    ((i) <= (raio) ? FAIXA_BITS((raio) - (i), 2 * (i) + 1) : FAIXA_BITS(0, 2 * (raio) + 1))
+#define LINHA_CRUZ(raio, i) \
+    ((i) == (raio) ? FAIXA_BITS(0, 2 * (raio) + 1) : FAIXA_BITS((raio), 1))
+#define MEIA_LARGURA_OCTAEDRO(raio, i) ((i) <= (raio) ? (i) : 2 * (raio) - (i))
+#define LINHA_OCTAEDRO(raio, i) \
+    FAIXA_BITS((raio) - MEIA_LARGURA_OCTAEDRO(raio, i), 2 * MEIA_LARGURA_OCTAEDRO(raio, i) + 1)
+
+#define LINHAS_CLASSICAS(LINHA) \
+    {LINHA(RAIO_CLASSICO, 0), LINHA(RAIO_CLASSICO, 1), LINHA(RAIO_CLASSICO, 2), \
+     LINHA(RAIO_CLASSICO, 3), LINHA(RAIO_CLASSICO, 4), LINHA(RAIO_CLASSICO, 5), \
+     LINHA(RAIO_CLASSICO, 6)}
+#define CELULAS_CLASSICAS(LINHA) \
+    (__builtin_popcountll(LINHA(RAIO_CLASSICO, 0)) + __builtin_popcountll(LINHA(RAIO_CLASSICO, 1)) + \
+     __builtin_popcountll(LINHA(RAIO_CLASSICO, 2)) + __builtin_popcountll(LINHA(RAIO_CLASSICO, 3)) + \
+     __builtin_popcountll(LINHA(RAIO_CLASSICO, 4)) + __builtin_popcountll(LINHA(RAIO_CLASSICO, 5)) + \
+     __builtin_popcountll(LINHA(RAIO_CLASSICO, 6)))
+
+// As três formas 7x7 de main(), montadas inteiramente em tempo de compilação
+static const FormaHabilidade FORMA_CONE_CLASSICA =
+    {FORMA_CONE, RAIO_CLASSICO, TAMANHO_MATRIZ_HABILIDADE, CELULAS_CLASSICAS(LINHA_CONE),
+     LINHAS_CLASSICAS(LINHA_CONE)};
+static const FormaHabilidade FORMA_CRUZ_CLASSICA =
+    {FORMA_CRUZ, RAIO_CLASSICO, TAMANHO_MATRIZ_HABILIDADE, CELULAS_CLASSICAS(LINHA_CRUZ),
+     LINHAS_CLASSICAS(LINHA_CRUZ)};
+static const FormaHabilidade FORMA_OCTAEDRO_CLASSICA =
+    {FORMA_OCTAEDRO, RAIO_CLASSICO, TAMANHO_MATRIZ_HABILIDADE, CELULAS_CLASSICAS(LINHA_OCTAEDRO),
+     LINHAS_CLASSICAS(LINHA_OCTAEDRO)};
+
+// Registro com todas as formas de raio 0 a RAIO_MAXIMO_FORMA, gerado uma única vez
+static FormaHabilidade registroFormas[QUANTIDADE_FORMAS][RAIO_MAXIMO_FORMA + 1];
+static pthread_once_t geracaoRegistroFormas = PTHREAD_ONCE_INIT;
+
+// Gera a linha i de uma forma de qualquer tipo
+static uint64_t gerarLinhaForma(TipoForma tipo, int raio, int i) {
+    uint64_t linha = 0;
+    int di = i - raio;
+
+    switch (tipo) {
+        case FORMA_CONE:     return LINHA_CONE(raio, i);
+        case FORMA_CRUZ:     return LINHA_CRUZ(raio, i);
+        case FORMA_OCTAEDRO: return LINHA_OCTAEDRO(raio, i);
+        case FORMA_CIRCULO:
+        case FORMA_ANEL:
+            // Limites r² + r e (r - 1)² + (r - 1) arredondam o disco para inteiros
+            for (int j = 0; j <= 2 * raio; j++) {
+                int dj = j - raio;
+                int d2 = di * di + dj * dj;
+                int dentro = d2 <= raio * raio + raio;
+                if (tipo == FORMA_ANEL && raio > 0) {
+                    dentro = dentro && d2 > raio * raio - raio;
+                }
+                if (dentro) {
+                    linha |= (uint64_t)1 << j;
+                }
+            }
+            return linha;
+        default:
+            return 0;
+    }
+}
+
+// Preenche o registro inteiro (executada uma vez por pthread_once)
+static void gerarRegistroFormas(void) {
+    for (int t = 0; t < QUANTIDADE_FORMAS; t++) {
+        for (int raio = 0; raio <= RAIO_MAXIMO_FORMA; raio++) {
+            FormaHabilidade *forma = &registroFormas[t][raio];
+            forma->tipo = (TipoForma)t;
+            forma->raio = raio;
+            forma->tamanho = 2 * raio + 1;
+            forma->celulas = 0;
+            for (int i = 0; i < LADO_MAXIMO_FORMA; i++) {
+                forma->linhas[i] = i < forma->tamanho ? gerarLinhaForma((TipoForma)t, raio, i) : 0;
+                forma->celulas += __builtin_popcountll(forma->linhas[i]);
+            }
+        }
+    }
+}
+
+/*
+ * Função: obterForma
+ * Propósito: Busca uma forma no registro (gerado uma única vez, na primeira chamada)
+ * Parâmetros:
+ *   - tipo: formato da área de efeito
+ *   - raio: de 0 a RAIO_MAXIMO_FORMA
+ * Retorno: ponteiro para a forma, válido durante todo o programa, ou NULL se
+ *          o tipo ou o raio forem inválidos
+ */
+const FormaHabilidade *obterForma(TipoForma tipo, int raio) {
+    if ((int)tipo < 0 || tipo >= QUANTIDADE_FORMAS || raio < 0 || raio > RAIO_MAXIMO_FORMA) {
+        return NULL;
+    }
+    // Formas clássicas não precisam do registro: já existem desde a compilação
+    if (raio == RAIO_CLASSICO) {
+        if (tipo == FORMA_CONE) return &FORMA_CONE_CLASSICA;
+        if (tipo == FORMA_CRUZ) return &FORMA_CRUZ_CLASSICA;
+        if (tipo == FORMA_OCTAEDRO) return &FORMA_OCTAEDRO_CLASSICA;
+    }
+    pthread_once(&geracaoRegistroFormas, gerarRegistroFormas);
+    return &registroFormas[tipo][raio];
+}
+
+/*
+ * Função: mascaraForma
+ * Propósito: Converte uma forma no bitboard da área afetada, centrada na origem
+ *            e recortada nos limites do tabuleiro, deslocando linhas inteiras
+ * Parâmetros:
+ *   - forma: forma do registro
+ *   - origem_linha, origem_coluna: ponto central da habilidade
+ * Retorno: bitboard com as células cobertas
+ */
+Bitboard mascaraForma(const FormaHabilidade *forma, int origem_linha, int origem_coluna) {
+    Bitboard mascara = bitboardVazio();
+    int primeiraColuna = origem_coluna - forma->raio;  // Coluna do bit 0 de cada linha
+
+    if (primeiraColuna >= TAMANHO_TABULEIRO || primeiraColuna <= -forma->tamanho) {
+        return mascara;  // Nenhuma coluna da forma cai no tabuleiro
+    }
+
+    for (int i = 0; i < forma->tamanho; i++) {
+        int linha = origem_linha - forma->raio + i;
+        if (linha < 0 || linha >= TAMANHO_TABULEIRO) {
+            continue;
+        }
+
+        uint64_t bits = primeiraColuna >= 0 ? forma->linhas[i] << primeiraColuna
+                                            : forma->linhas[i] >> -primeiraColuna;
+        bits &= ((uint64_t)1 << TAMANHO_TABULEIRO) - 1;  // Recorta as colunas excedentes
+        mascara = bitboardOu(mascara, bitboardLinha(linha, bits));
+    }
+    return mascara;
+}
+
+/*
+ * Função: aplicarFormaBits
+ * Propósito: Marca a área de uma forma nas células de água do tabuleiro em bits
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits
+ *   - forma: forma do registro
+ *   - origem_linha, origem_coluna: ponto central da habilidade
+ * Retorno: void (não retorna valor)
+ */
+void aplicarFormaBits(TabuleiroBits *tabuleiro, const FormaHabilidade *forma,
+                      int origem_linha, int origem_coluna) {
+    INSTRUMENTAR_INICIO();
+    Bitboard area = mascaraForma(forma, origem_linha, origem_coluna);
+    Bitboard novas = bitboardENao(bitboardENao(area, tabuleiro->navios), tabuleiro->habilidade);
+    tabuleiro->habilidade = bitboardOu(tabuleiro->habilidade, novas);
+    tabuleiro->hash ^= hashCamadaZobrist(ZOBRIST_HABILIDADE, novas);
+    INSTRUMENTAR_FIM(PONTO_APLICAR_FORMA, 0);
+}
+
+/*
+ * Função: expandirForma
+ * Propósito: Copia uma forma de raio RAIO_CLASSICO para a matriz 7x7 tradicional
+ * Parâmetros:
+ *   - forma: forma com tamanho TAMANHO_MATRIZ_HABILIDADE
+ *   - matriz: matriz 7x7 que receberá 1 nas posições afetadas e 0 nas demais
+ * Retorno: void (não retorna valor)
+ */
+void expandirForma(const FormaHabilidade *forma,
+                   int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]) {
+    for (int i = 0; i < TAMANHO_MATRIZ_HABILIDADE; i++) {
+        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
+            matriz[i][j] = (int)((forma->linhas[i] >> j) & 1);
+        }
+    }
+}
+
+// ---------- Aplicação de vários efeitos em uma única passada ----------
+
+#define NIVEIS_CONTADOR 32  // Planos de bits do contador de efeitos (contagens de 32 bits)
+
+/*
+ * Função: aplicarEfeitosBits
+ * Propósito: Resolve uma lista de efeitos de habilidade no mesmo tabuleiro, sem cópias
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits
+ *   - efeitos: lista de efeitos (forma e origem)
+ *   - quantidade: número de efeitos
+ *   - contagem: NULL para marcar HABILIDADE no tabuleiro; caso contrário, recebe
+ *               quantos efeitos atingem cada célula e o tabuleiro não é alterado
+ * Retorno: void (não retorna valor)
+ * Lógica: As áreas são acumuladas em registradores e o tabuleiro é escrito uma só
+ *         vez. A contagem usa um contador "fatiado em bits": o plano k guarda o
+ *         bit k da contagem de todas as 100 células, e somar uma área é uma
+ *         propagação de vai-um feita com AND/XOR sobre bitboards inteiros.
+ */
+void aplicarEfeitosBits(TabuleiroBits *tabuleiro, const EfeitoHabilidade *efeitos, int quantidade,
+                        uint32_t contagem[CELULAS_TABULEIRO]) {
+    if (contagem == NULL) {
+        Bitboard uniao = bitboardVazio();
+        for (int e = 0; e < quantidade; e++) {
+            uniao = bitboardOu(uniao, mascaraForma(efeitos[e].forma, efeitos[e].linha,
+                                                   efeitos[e].coluna));
+        }
+        Bitboard novas = bitboardENao(bitboardENao(uniao, tabuleiro->navios),
+                                      tabuleiro->habilidade);
+        tabuleiro->habilidade = bitboardOu(tabuleiro->habilidade, novas);
+        tabuleiro->hash ^= hashCamadaZobrist(ZOBRIST_HABILIDADE, novas);
+        return;
+    }
+
+    Bitboard planos[NIVEIS_CONTADOR];
+    int niveisUsados = 0;
+    for (int k = 0; k < NIVEIS_CONTADOR; k++) {
+        planos[k] = bitboardVazio();
+    }
+
+    for (int e = 0; e < quantidade; e++) {
+        Bitboard vaiUm = mascaraForma(efeitos[e].forma, efeitos[e].linha, efeitos[e].coluna);
+        for (int k = 0; k < NIVEIS_CONTADOR && !bitboardEstaVazio(vaiUm); k++) {
+            Bitboard proximo = bitboardE(planos[k], vaiUm);
+            planos[k].palavra[0] ^= vaiUm.palavra[0];
+            planos[k].palavra[1] ^= vaiUm.palavra[1];
+            vaiUm = proximo;
+            if (k + 1 > niveisUsados) {
+                niveisUsados = k + 1;
+            }
+        }
+    }
+
+    // Converte os planos de volta em uma contagem por célula
+    for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+        uint32_t valor = 0;
+        for (int k = 0; k < niveisUsados; k++) {
+            valor |= (uint32_t)bitboardContemCelula(planos[k], c) << k;
+        }
+        contagem[c] = valor;
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Arquivo: src/frota.c
+ * Descrição: Geração aleatória de frotas completas
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== GERAÇÃO ALEATÓRIA DE FROTAS ==========
+
+/*
+ * Função: gerarFrota
+ * Propósito: Sorteia uma frota legal (dentro dos limites e sem sobreposição)
+ * Parâmetros:
+ *   - gerador: gerador pseudoaleatório que define a frota sorteada
+ *   - modo: FROTA_RAPIDA ou FROTA_UNIFORME
+ *   - frota: recebe a frota sorteada
+ * Retorno: void (não retorna valor)
+ */
+void gerarFrota(GeradorAleatorio *gerador, ModoGeracaoFrota modo, Frota *frota) {
+    inicializarTabelaPosicionamentos();
+
+    frota->ocupacao = bitboardVazio();
+    for (int n = 0; n < QUANTIDADE_NAVIOS; n++) {
+        const Posicionamento *p =
+            &tabelaPosicionamentos[aleatorioAte(gerador, (uint32_t)quantidadePosicionamentos)];
+
+        if (bitboardTemInterseccao(frota->ocupacao, p->ocupacao)) {
+            if (modo == FROTA_UNIFORME) {
+                frota->ocupacao = bitboardVazio();  // Recomeça a frota do zero
+                n = -1;
+            } else {
+                n--;  // Sorteia de novo apenas este navio
+            }
+            continue;
+        }
+
+        frota->navios[n] = p;
+        frota->ocupacao = bitboardOu(frota->ocupacao, p->ocupacao);
+    }
+}
+
+/*
+ * Função: posicionarFrotaBits
+ * Propósito: Posiciona todos os navios de uma frota no tabuleiro em bits
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits
+ *   - frota: frota gerada por gerarFrota
+ * Retorno: void (não retorna valor)
+ */
+void posicionarFrotaBits(TabuleiroBits *tabuleiro, const Frota *frota) {
+    for (int n = 0; n < QUANTIDADE_NAVIOS; n++) {
+        posicionarNavioBits(tabuleiro, frota->navios[n]->linha, frota->navios[n]->coluna,
+                            frota->navios[n]->orientacao);
+    }
+}
@@ -0,0 +1,311 @@
+/*
+ * Arquivo: src/historico.c
+ * Descrição: Histórico de jogadas desfazíveis (instantâneos sem cópia do tabuleiro)
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== HISTÓRICO DO TABULEIRO EM BITS ==========
+
+// Diferença (XOR) entre duas camadas
+static Bitboard bitboardDiferenca(Bitboard a, Bitboard b) {
+    Bitboard r = {{a.palavra[0] ^ b.palavra[0], a.palavra[1] ^ b.palavra[1]}};
+    return r;
+}
+
+// Empilha uma jogada; as camadas que a jogada não altera ficam zeradas
+static DeltaTabuleiro *empilharDelta(HistoricoTabuleiro *historico, uint64_t hash, int navio,
+                                     int navioAdicionado) {
+    DeltaTabuleiro *delta = &historico->deltas[historico->quantidade++];
+    memset(delta, 0, sizeof(*delta));
+    delta->hash = hash;
+    delta->navio = (signed char)navio;
+    delta->navioAdicionado = (unsigned char)navioAdicionado;
+    return delta;
+}
+
+/*
+ * Função: iniciarHistoricoTabuleiro
+ * Propósito: Prepara um histórico vazio sobre uma memória fornecida (pilha local,
+ *            arena...), para que a busca não faça alocações
+ * Parâmetros:
+ *   - historico: histórico a ser preparado
+ *   - deltas: memória para capacidade jogadas
+ *   - capacidade: máximo de jogadas simultaneamente desfazíveis
+ * Retorno: void (não retorna valor)
+ * Nota: A marca para voltarHistoricoTabuleiro é historico->quantidade no momento
+ *       do instantâneo.
+ */
+void iniciarHistoricoTabuleiro(HistoricoTabuleiro *historico, DeltaTabuleiro *deltas,
+                               int capacidade) {
+    historico->deltas = deltas;
+    historico->quantidade = 0;
+    historico->capacidade = capacidade;
+}
+
+/*
+ * Função: posicionarNavioDesfazivel
+ * Propósito: Posiciona um navio guardando o necessário para desfazê-lo
+ * Parâmetros:
+ *   - historico: histórico de jogadas
+ *   - tabuleiro: tabuleiro em bits
+ *   - navios: tabela de navios do tabuleiro, ou NULL se não for usada
+ *   - posicionamento: entrada da tabela de posicionamentos (já validada)
+ * Retorno: 0 em caso de sucesso, -1 se o histórico ou a tabela de navios estiverem
+ *          cheios (nada é alterado)
+ */
+int posicionarNavioDesfazivel(HistoricoTabuleiro *historico, TabuleiroBits *tabuleiro,
+                              TabelaNavios *navios, const Posicionamento *posicionamento) {
+    Bitboard navioAntes = tabuleiro->navios;
+    Bitboard habilidadeAntes = tabuleiro->habilidade;
+    uint64_t hashAntes = tabuleiro->hash;
+    DeltaTabuleiro *delta;
+
+    if (historico->quantidade >= historico->capacidade) {
+        return -1;
+    }
+    if (navios != NULL && adicionarNavioRastreado(navios, posicionamento) < 0) {
+        return -1;
+    }
+    posicionarNavioBits(tabuleiro, posicionamento->linha, posicionamento->coluna,
+                        posicionamento->orientacao);
+    delta = empilharDelta(historico, hashAntes ^ tabuleiro->hash, -1, navios != NULL);
+    delta->navios = bitboardDiferenca(navioAntes, tabuleiro->navios);
+    delta->habilidade = bitboardDiferenca(habilidadeAntes, tabuleiro->habilidade);
+    return 0;
+}
+
+/*
+ * Função: aplicarFormaDesfazivel
+ * Propósito: Aplica uma forma do registro guardando o necessário para desfazê-la
+ * Parâmetros:
+ *   - historico: histórico de jogadas
+ *   - tabuleiro: tabuleiro em bits
+ *   - forma: forma do registro
+ *   - origem_linha, origem_coluna: ponto central da habilidade
+ * Retorno: 0 em caso de sucesso, -1 se o histórico estiver cheio
+ */
+int aplicarFormaDesfazivel(HistoricoTabuleiro *historico, TabuleiroBits *tabuleiro,
+                           const FormaHabilidade *forma, int origem_linha, int origem_coluna) {
+    Bitboard antes = tabuleiro->habilidade;
+    uint64_t hashAntes = tabuleiro->hash;
+
+    if (historico->quantidade >= historico->capacidade) {
+        return -1;
+    }
+    aplicarFormaBits(tabuleiro, forma, origem_linha, origem_coluna);
+    empilharDelta(historico, hashAntes ^ tabuleiro->hash, -1, 0)->habilidade =
+        bitboardDiferenca(antes, tabuleiro->habilidade);
+    return 0;
+}
+
+/*
+ * Função: aplicarHabilidadeDesfazivel
+ * Propósito: Versão desfazível de aplicarHabilidadeBits (matriz 7x7 tradicional),
+ *            usada nas prévias de habilidade: aplica, exibe e desfaz, sem copiar
+ *            o tabuleiro
+ * Parâmetros: os de aplicarHabilidadeBits, precedidos pelo histórico
+ * Retorno: 0 em caso de sucesso, -1 se o histórico estiver cheio
+ */
+int aplicarHabilidadeDesfazivel(HistoricoTabuleiro *historico, TabuleiroBits *tabuleiro,
+                                int matrizHabilidade[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE],
+                                int origem_linha, int origem_coluna) {
+    Bitboard antes = tabuleiro->habilidade;
+    uint64_t hashAntes = tabuleiro->hash;
+
+    if (historico->quantidade >= historico->capacidade) {
+        return -1;
+    }
+    aplicarHabilidadeBits(tabuleiro, matrizHabilidade, origem_linha, origem_coluna);
+    empilharDelta(historico, hashAntes ^ tabuleiro->hash, -1, 0)->habilidade =
+        bitboardDiferenca(antes, tabuleiro->habilidade);
+    return 0;
+}
+
+/*
+ * Função: atirarDesfazivel
+ * Propósito: Registra um tiro guardando o necessário para desfazê-lo
+ * Parâmetros:
+ *   - historico: histórico de jogadas
+ *   - tabuleiro: tabuleiro em bits
+ *   - navios: tabela de navios (resolve afundamento e fim de jogo), ou NULL
+ *   - celula: índice da célula atingida (INDICE_CELULA)
+ * Retorno: ResultadoTiro (sem a tabela, apenas TIRO_AGUA, TIRO_ACERTO ou
+ *          TIRO_REPETIDO), ou -1 se o histórico estiver cheio
+ */
+int atirarDesfazivel(HistoricoTabuleiro *historico, TabuleiroBits *tabuleiro,
+                     TabelaNavios *navios, int celula) {
+    Bitboard antes = tabuleiro->tiros;
+    uint64_t hashAntes = tabuleiro->hash;
+    ResultadoTiro resultado;
+    int navio = -1;
+
+    if (historico->quantidade >= historico->capacidade) {
+        return -1;
+    }
+    if (navios != NULL) {
+        resultado = resolverTiro(navios, tabuleiro, celula, &navio);
+        if (resultado == TIRO_REPETIDO) {
+            navio = -1;  // Nada mudou na tabela
+        }
+    } else if (bitboardContemCelula(tabuleiro->tiros, celula)) {
+        resultado = TIRO_REPETIDO;
+    } else {
+        resultado = registrarTiroBits(tabuleiro, celula) ? TIRO_ACERTO : TIRO_AGUA;
+    }
+    empilharDelta(historico, hashAntes ^ tabuleiro->hash, navio, 0)->tiros =
+        bitboardDiferenca(antes, tabuleiro->tiros);
+    return (int)resultado;
+}
+
+/*
+ * Função: voltarHistoricoTabuleiro
+ * Propósito: Desfaz, da mais recente para a mais antiga, as jogadas feitas depois
+ *            da marca
+ * Parâmetros:
+ *   - historico: histórico de jogadas
+ *   - tabuleiro: tabuleiro em bits
+ *   - navios: a mesma tabela usada nas jogadas (NULL se nenhuma foi usada)
+ *   - marca: historico->quantidade no momento do instantâneo
+ * Retorno: void (não retorna valor)
+ */
+void voltarHistoricoTabuleiro(HistoricoTabuleiro *historico, TabuleiroBits *tabuleiro,
+                              TabelaNavios *navios, int marca) {
+    while (historico->quantidade > marca) {
+        const DeltaTabuleiro *delta = &historico->deltas[--historico->quantidade];
+
+        tabuleiro->navios = bitboardDiferenca(tabuleiro->navios, delta->navios);
+        tabuleiro->habilidade = bitboardDiferenca(tabuleiro->habilidade, delta->habilidade);
+        tabuleiro->tiros = bitboardDiferenca(tabuleiro->tiros, delta->tiros);
+        tabuleiro->hash ^= delta->hash;
+        if (navios == NULL) {
+            continue;
+        }
+
+        if (delta->navio >= 0) {
+            // O tiro que zerou o navio também descontou um navio da frota
+            if (++navios->navios[delta->navio].restantes == 1) {
+                navios->naviosRestantes++;
+            }
+        }
+        if (delta->navioAdicionado) {
+            // Pilha: o navio desta jogada é sempre o último da tabela
+            const NavioRastreado *removido = &navios->navios[--navios->quantidadeNavios];
+            for (int i = 0; i < TAMANHO_NAVIO; i++) {
+                navios->navioDaCelula[removido->celulas[i]] = SEM_NAVIO;
+            }
+            navios->naviosRestantes--;
+        }
+    }
+}
+
+// ========== HISTÓRICO DO TABULEIRO DINÂMICO ==========
+
+/*
+ * Função: iniciarHistoricoDinamico
+ * Propósito: Prepara um registro vazio sobre uma memória fornecida
+ * Parâmetros:
+ *   - historico: histórico a ser preparado
+ *   - alteracoes: memória para capacidade células
+ *   - capacidade: máximo de células alteradas simultaneamente desfazíveis
+ * Retorno: void (não retorna valor)
+ * Nota: A marca para voltarHistoricoDinamico é historico->quantidade.
+ */
+void iniciarHistoricoDinamico(HistoricoDinamico *historico, AlteracaoCelula *alteracoes,
+                              size_t capacidade) {
+    historico->alteracoes = alteracoes;
+    historico->quantidade = 0;
+    historico->capacidade = capacidade;
+}
+
+// Guarda o valor atual de uma célula e escreve o novo
+static void alterarCelula(HistoricoDinamico *historico, TabuleiroDinamico *tabuleiro,
+                          size_t deslocamento, unsigned char valor) {
+    AlteracaoCelula *alteracao = &historico->alteracoes[historico->quantidade++];
+    alteracao->deslocamento = deslocamento;
+    alteracao->anterior = tabuleiro->celulas[deslocamento];
+    tabuleiro->celulas[deslocamento] = valor;
+}
+
+/*
+ * Função: posicionarNavioDinamicoDesfazivel
+ * Propósito: Versão desfazível de posicionarNavioDinamico
+ * Parâmetros: os de posicionarNavioDinamico, precedidos pelo histórico
+ * Retorno: 0 em caso de sucesso, -1 se o histórico não comportar o navio
+ * Nota: Assume que a validação já foi feita antes de chamar esta função
+ */
+int posicionarNavioDinamicoDesfazivel(HistoricoDinamico *historico, TabuleiroDinamico *tabuleiro,
+                                      int linha, int coluna, int tamanho, char orientacao) {
+    int passoLinha, passoColuna;
+
+    if (historico->capacidade - historico->quantidade < (size_t)tamanho) {
+        return -1;
+    }
+    obterDeslocamentoOrientacao(orientacao, &passoLinha, &passoColuna);
+    for (int i = 0; i < tamanho; i++) {
+        size_t deslocamento = (size_t)(linha + i * passoLinha) * (size_t)tabuleiro->passo +
+                              (size_t)(coluna + i * passoColuna);
+        alterarCelula(historico, tabuleiro, deslocamento, NAVIO);
+    }
+    return 0;
+}
+
+/*
+ * Função: aplicarFormaDinamicoDesfazivel
+ * Propósito: Versão desfazível de aplicarFormaDinamico; registra apenas as
+ *            células de água que viram HABILIDADE
+ * Parâmetros: os de aplicarFormaDinamico, precedidos pelo histórico
+ * Retorno: 0 em caso de sucesso, -1 se o histórico encher (a aplicação parcial
+ *          é desfeita)
+ */
+int aplicarFormaDinamicoDesfazivel(HistoricoDinamico *historico, TabuleiroDinamico *tabuleiro,
+                                   const FormaHabilidade *forma,
+                                   int origem_linha, int origem_coluna) {
+    size_t marca = historico->quantidade;
+    int primeiraColuna = origem_coluna - forma->raio;
+    int colunaInicio = primeiraColuna < 0 ? -primeiraColuna : 0;
+    int colunaFim = tabuleiro->largura - primeiraColuna;
+    if (colunaFim > forma->tamanho) colunaFim = forma->tamanho;
+    if (colunaFim <= colunaInicio) {
+        return 0;  // Nenhuma coluna da forma cai no tabuleiro
+    }
+
+    uint64_t recorte = FAIXA_BITS(colunaInicio, colunaFim - colunaInicio);
+    for (int i = 0; i < forma->tamanho; i++) {
+        int linha = origem_linha - forma->raio + i;
+        if (linha < 0 || linha >= tabuleiro->altura) {
+            continue;
+        }
+        size_t inicioLinha = (size_t)linha * (size_t)tabuleiro->passo;
+        for (uint64_t bits = forma->linhas[i] & recorte; bits; bits &= bits - 1) {
+            size_t deslocamento = inicioLinha + (size_t)(primeiraColuna + __builtin_ctzll(bits));
+            if (tabuleiro->celulas[deslocamento] != AGUA) {
+                continue;
+            }
+            if (historico->quantidade == historico->capacidade) {
+                voltarHistoricoDinamico(historico, tabuleiro, marca);
+                return -1;
+            }
+            alterarCelula(historico, tabuleiro, deslocamento, HABILIDADE);
+        }
+    }
+    return 0;
+}
+
+/*
+ * Função: voltarHistoricoDinamico
+ * Propósito: Restaura, da mais recente para a mais antiga, as células alteradas
+ *            depois da marca
+ * Parâmetros:
+ *   - historico: histórico de células
+ *   - tabuleiro: tabuleiro dinâmico
+ *   - marca: historico->quantidade no momento do instantâneo
+ * Retorno: void (não retorna valor)
+ */
+void voltarHistoricoDinamico(HistoricoDinamico *historico, TabuleiroDinamico *tabuleiro,
+                             size_t marca) {
+    while (historico->quantidade > marca) {
+        const AlteracaoCelula *alteracao = &historico->alteracoes[--historico->quantidade];
+        tabuleiro->celulas[alteracao->deslocamento] = alteracao->anterior;
+    }
+}
@@ -0,0 +1,410 @@
+/*
+ * Arquivo: src/instrumentacao.c
+ * Descrição: Contadores e histogramas de ciclos das funções críticas, com
+ *            exportação em JSON ou no formato texto do Prometheus
+ */
+
+#include "batalha_naval_interno.h"
+
+#include <stdatomic.h>
+#include <time.h>
+
+// ========== INSTRUMENTAÇÃO DAS FUNÇÕES CRÍTICAS ==========
+
+#ifndef UNIDADE_CICLOS
+#define UNIDADE_CICLOS "ciclos"
+#endif
+
+// Nomes exportados, na ordem de PontoInstrumentado. Os pontos de sobreposição,
+// posicionamento e habilidade somam a matriz tradicional e o motor em bits.
+static const char *const NOMES_PONTOS[QUANTIDADE_PONTOS_INSTRUMENTADOS] = {
+    "validarPosicao",
+    "verificarSobreposicao",
+    "buscarPosicionamentoLivre",
+    "posicionarNavio",
+    "aplicarHabilidade",
+    "aplicarFormaBits"
+};
+
+/*
+ * Tipo: BlocoInstrumentacao
+ * Propósito: Contadores de uma thread. Só a thread dona escreve (carga e
+ *            armazenamento relaxados, sem instrução atômica de soma); a coleta
+ *            lê os blocos de todas as threads sem interrompê-las.
+ * Campos:
+ *   - chamadas, rejeicoes, ciclos, histograma: totais por ponto instrumentado
+ *   - proximo: próximo bloco da lista global
+ *   - emUso: 1 enquanto alguma thread é dona do bloco
+ * Nota: Quando a thread termina o bloco fica livre e é adotado pela próxima
+ *       thread nova; como os contadores são totais acumulados, nada se perde.
+ */
+typedef struct BlocoInstrumentacao {
+    _Atomic uint64_t chamadas[QUANTIDADE_PONTOS_INSTRUMENTADOS];
+    _Atomic uint64_t rejeicoes[QUANTIDADE_PONTOS_INSTRUMENTADOS];
+    _Atomic uint64_t ciclos[QUANTIDADE_PONTOS_INSTRUMENTADOS];
+    _Atomic uint64_t histograma[QUANTIDADE_PONTOS_INSTRUMENTADOS][FAIXAS_HISTOGRAMA_CICLOS];
+    struct BlocoInstrumentacao *proximo;
+    atomic_int emUso;
+} BlocoInstrumentacao;
+
+static BlocoInstrumentacao *blocosInstrumentacao;
+static pthread_mutex_t travaBlocos = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t chaveBlocoThread;
+static pthread_once_t criacaoChaveBloco = PTHREAD_ONCE_INIT;
+static _Thread_local BlocoInstrumentacao *blocoThreadAtual;
+
+// Destrutor chamado no término de cada thread que registrou medições
+static void liberarBlocoThread(void *bloco) {
+    atomic_store_explicit(&((BlocoInstrumentacao *)bloco)->emUso, 0, memory_order_release);
+}
+
+static void criarChaveBloco(void) {
+    pthread_key_create(&chaveBlocoThread, liberarBlocoThread);
+}
+
+// Bloco da thread chamadora: adota um bloco livre ou cria um novo
+static BlocoInstrumentacao *blocoDaThread(void) {
+    BlocoInstrumentacao *bloco;
+
+    if (blocoThreadAtual != NULL) {
+        return blocoThreadAtual;
+    }
+    pthread_once(&criacaoChaveBloco, criarChaveBloco);
+
+    pthread_mutex_lock(&travaBlocos);
+    for (bloco = blocosInstrumentacao; bloco != NULL; bloco = bloco->proximo) {
+        if (!atomic_load_explicit(&bloco->emUso, memory_order_acquire)) {
+            break;
+        }
+    }
+    if (bloco == NULL && (bloco = alocarAlinhado(sizeof(BlocoInstrumentacao))) != NULL) {
+        memset(bloco, 0, sizeof(BlocoInstrumentacao));
+        bloco->proximo = blocosInstrumentacao;
+        blocosInstrumentacao = bloco;
+    }
+    if (bloco != NULL) {
+        atomic_store_explicit(&bloco->emUso, 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&travaBlocos);
+
+    if (bloco != NULL) {
+        pthread_setspecific(chaveBlocoThread, bloco);
+        blocoThreadAtual = bloco;
+    }
+    return bloco;
+}
+
+// Soma em um contador escrito apenas pela thread dona
+static inline void somarContador(_Atomic uint64_t *contador, uint64_t valor) {
+    atomic_store_explicit(contador, atomic_load_explicit(contador, memory_order_relaxed) + valor,
+                          memory_order_relaxed);
+}
+
+/*
+ * Função: instrumentacaoAtiva
+ * Propósito: Informa se a biblioteca foi compilada com BATALHA_INSTRUMENTACAO
+ * Retorno: 1 se as funções críticas registram medições, 0 caso contrário
+ */
+int instrumentacaoAtiva(void) {
+#ifdef BATALHA_INSTRUMENTACAO
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/*
+ * Função: registrarMedicao
+ * Propósito: Acumula uma chamada medida (usada pela macro INSTRUMENTAR_FIM)
+ * Parâmetros:
+ *   - ponto: função medida
+ *   - ciclos: duração da chamada
+ *   - rejeitada: 1 se a chamada recusou o navio
+ * Retorno: void (não retorna valor)
+ * Nota: Sem memória para o bloco da thread, a medição é descartada.
+ */
+void registrarMedicao(PontoInstrumentado ponto, uint64_t ciclos, int rejeitada) {
+    BlocoInstrumentacao *bloco = blocoDaThread();
+    int faixa = 63 - __builtin_clzll(ciclos | 1);
+
+    if (bloco == NULL) {
+        return;
+    }
+    if (faixa >= FAIXAS_HISTOGRAMA_CICLOS) {
+        faixa = FAIXAS_HISTOGRAMA_CICLOS - 1;
+    }
+    somarContador(&bloco->chamadas[ponto], 1);
+    somarContador(&bloco->ciclos[ponto], ciclos);
+    somarContador(&bloco->histograma[ponto][faixa], 1);
+    if (rejeitada) {
+        somarContador(&bloco->rejeicoes[ponto], 1);
+    }
+}
+
+/*
+ * Função: coletarInstrumentacao
+ * Propósito: Soma os contadores de todas as threads (atuais e já encerradas)
+ * Parâmetros:
+ *   - estatisticas: recebe os totais de cada ponto instrumentado
+ * Retorno: void (não retorna valor)
+ * Nota: Pode ser chamada enquanto as medições continuam; cada contador lido é
+ *       exato, mas o conjunto não é um instantâneo atômico.
+ */
+void coletarInstrumentacao(EstatisticaPonto estatisticas[QUANTIDADE_PONTOS_INSTRUMENTADOS]) {
+    memset(estatisticas, 0, QUANTIDADE_PONTOS_INSTRUMENTADOS * sizeof(EstatisticaPonto));
+
+    pthread_mutex_lock(&travaBlocos);
+    for (const BlocoInstrumentacao *bloco = blocosInstrumentacao; bloco != NULL;
+         bloco = bloco->proximo) {
+        for (int p = 0; p < QUANTIDADE_PONTOS_INSTRUMENTADOS; p++) {
+            EstatisticaPonto *e = &estatisticas[p];
+            e->chamadas += atomic_load_explicit(&bloco->chamadas[p], memory_order_relaxed);
+            e->rejeicoes += atomic_load_explicit(&bloco->rejeicoes[p], memory_order_relaxed);
+            e->ciclos += atomic_load_explicit(&bloco->ciclos[p], memory_order_relaxed);
+            for (int f = 0; f < FAIXAS_HISTOGRAMA_CICLOS; f++) {
+                e->histograma[f] += atomic_load_explicit(&bloco->histograma[p][f],
+                                                         memory_order_relaxed);
+            }
+        }
+    }
+    pthread_mutex_unlock(&travaBlocos);
+}
+
+// ---------- Exportação ----------
+
+// Razão protegida contra divisão por zero
+static double razao(uint64_t parte, uint64_t total) {
+    return total > 0 ? (double)parte / (double)total : 0.0;
+}
+
+static void escreverJson(FILE *arquivo, const EstatisticaPonto *estatisticas) {
+    fprintf(arquivo, "{\n  \"instrumentacao\": %s,\n  \"unidade\": \"%s\",\n"
+                     "  \"momento\": %.3f,\n  \"funcoes\": {\n",
+            instrumentacaoAtiva() ? "true" : "false", UNIDADE_CICLOS, relogioSegundos());
+    for (int p = 0; p < QUANTIDADE_PONTOS_INSTRUMENTADOS; p++) {
+        const EstatisticaPonto *e = &estatisticas[p];
+        fprintf(arquivo,
+                "    \"%s\": {\"chamadas\": %llu, \"rejeicoes\": %llu, \"taxaRejeicao\": %.6f, "
+                "\"ciclos\": %llu, \"ciclosMedios\": %.2f, \"histograma\": [",
+                NOMES_PONTOS[p], (unsigned long long)e->chamadas,
+                (unsigned long long)e->rejeicoes, razao(e->rejeicoes, e->chamadas),
+                (unsigned long long)e->ciclos, razao(e->ciclos, e->chamadas));
+        for (int f = 0; f < FAIXAS_HISTOGRAMA_CICLOS; f++) {
+            fprintf(arquivo, "%s%llu", f > 0 ? ", " : "", (unsigned long long)e->histograma[f]);
+        }
+        fprintf(arquivo, "]}%s\n", p + 1 < QUANTIDADE_PONTOS_INSTRUMENTADOS ? "," : "");
+    }
+    fprintf(arquivo, "  }\n}\n");
+}
+
+static void escreverPrometheus(FILE *arquivo, const EstatisticaPonto *estatisticas) {
+    fprintf(arquivo, "# HELP batalha_naval_instrumentacao_ativa 1 se compilada com "
+                     "BATALHA_INSTRUMENTACAO\n"
+                     "# TYPE batalha_naval_instrumentacao_ativa gauge\n"
+                     "batalha_naval_instrumentacao_ativa %d\n", instrumentacaoAtiva());
+
+    fprintf(arquivo, "# HELP batalha_naval_chamadas_total Chamadas por funcao instrumentada\n"
+                     "# TYPE batalha_naval_chamadas_total counter\n");
+    for (int p = 0; p < QUANTIDADE_PONTOS_INSTRUMENTADOS; p++) {
+        fprintf(arquivo, "batalha_naval_chamadas_total{funcao=\"%s\"} %llu\n", NOMES_PONTOS[p],
+                (unsigned long long)estatisticas[p].chamadas);
+    }
+
+    fprintf(arquivo, "# HELP batalha_naval_rejeicoes_total Navios recusados pelas validacoes\n"
+                     "# TYPE batalha_naval_rejeicoes_total counter\n");
+    for (int p = 0; p < QUANTIDADE_PONTOS_INSTRUMENTADOS; p++) {
+        fprintf(arquivo, "batalha_naval_rejeicoes_total{funcao=\"%s\"} %llu\n", NOMES_PONTOS[p],
+                (unsigned long long)estatisticas[p].rejeicoes);
+    }
+
+    fprintf(arquivo, "# HELP batalha_naval_ciclos Duracao das chamadas (%s)\n"
+                     "# TYPE batalha_naval_ciclos histogram\n", UNIDADE_CICLOS);
+    for (int p = 0; p < QUANTIDADE_PONTOS_INSTRUMENTADOS; p++) {
+        const EstatisticaPonto *e = &estatisticas[p];
+        uint64_t acumulado = 0;
+        // A faixa f termina em 2^(f+1) - 1; a última é aberta e vira +Inf
+        for (int f = 0; f < FAIXAS_HISTOGRAMA_CICLOS - 1; f++) {
+            acumulado += e->histograma[f];
+            fprintf(arquivo, "batalha_naval_ciclos_bucket{funcao=\"%s\",le=\"%llu\"} %llu\n",
+                    NOMES_PONTOS[p], (unsigned long long)(((uint64_t)2 << f) - 1),
+                    (unsigned long long)acumulado);
+        }
+        fprintf(arquivo, "batalha_naval_ciclos_bucket{funcao=\"%s\",le=\"+Inf\"} %llu\n"
+                         "batalha_naval_ciclos_sum{funcao=\"%s\"} %llu\n"
+                         "batalha_naval_ciclos_count{funcao=\"%s\"} %llu\n",
+                NOMES_PONTOS[p], (unsigned long long)e->chamadas,
+                NOMES_PONTOS[p], (unsigned long long)e->ciclos,
+                NOMES_PONTOS[p], (unsigned long long)e->chamadas);
+    }
+}
+
+/*
+ * Função: escreverMetricas
+ * Propósito: Escreve os totais atuais em um arquivo aberto
+ * Parâmetros:
+ *   - arquivo: destino (stdout, arquivo...)
+ *   - formato: METRICAS_JSON ou METRICAS_PROMETHEUS
+ * Retorno: 0 em caso de sucesso, -1 se a escrita falhar
+ */
+int escreverMetricas(FILE *arquivo, FormatoMetricas formato) {
+    EstatisticaPonto estatisticas[QUANTIDADE_PONTOS_INSTRUMENTADOS];
+
+    coletarInstrumentacao(estatisticas);
+    if (formato == METRICAS_PROMETHEUS) {
+        escreverPrometheus(arquivo, estatisticas);
+    } else {
+        escreverJson(arquivo, estatisticas);
+    }
+    return ferror(arquivo) ? -1 : 0;
+}
+
+/*
+ * Função: gravarMetricas
+ * Propósito: Substitui o arquivo de métricas pelos totais atuais
+ * Parâmetros:
+ *   - caminho: arquivo de destino
+ *   - formato: METRICAS_JSON ou METRICAS_PROMETHEUS
+ * Retorno: 0 em caso de sucesso, -1 em caso de erro
+ * Nota: Escreve em "<caminho>.tmp" e renomeia, para que um leitor (coletor do
+ *       Prometheus, tail, script) nunca veja um arquivo pela metade.
+ */
+int gravarMetricas(const char *caminho, FormatoMetricas formato) {
+    size_t tamanho = strlen(caminho);
+    char *temporario = malloc(tamanho + sizeof(".tmp"));
+    FILE *arquivo;
+    int erro;
+
+    if (temporario == NULL) {
+        return -1;
+    }
+    memcpy(temporario, caminho, tamanho);
+    memcpy(temporario + tamanho, ".tmp", sizeof(".tmp"));
+
+    arquivo = fopen(temporario, "w");
+    if (arquivo == NULL) {
+        free(temporario);
+        return -1;
+    }
+    erro = escreverMetricas(arquivo, formato);
+    erro |= fclose(arquivo) != 0 ? -1 : 0;
+#ifdef _WIN32
+    if (!erro) {
+        remove(caminho);  // rename não substitui um arquivo existente no Windows
+    }
+#endif
+    if (erro || rename(temporario, caminho) != 0) {
+        remove(temporario);
+        erro = -1;
+    }
+    free(temporario);
+    return erro;
+}
+
+// ---------- Exportação periódica ----------
+
+/*
+ * Tipo: ExportadorMetricas
+ * Propósito: Thread que grava as métricas a cada intervalo (uma por processo)
+ */
+typedef struct {
+    pthread_mutex_t trava;
+    pthread_cond_t condicao;
+    pthread_t thread;
+    int ativo;
+    int parar;
+    char *caminho;
+    FormatoMetricas formato;
+    double intervalo;
+} ExportadorMetricas;
+
+static ExportadorMetricas exportador = {
+    .trava = PTHREAD_MUTEX_INITIALIZER,
+    .condicao = PTHREAD_COND_INITIALIZER
+};
+
+static void *executarExportador(void *argumento) {
+    (void)argumento;
+
+    pthread_mutex_lock(&exportador.trava);
+    while (!exportador.parar) {
+        struct timespec prazo;
+        double segundos;
+        timespec_get(&prazo, TIME_UTC);
+        segundos = (double)prazo.tv_nsec * 1e-9 + exportador.intervalo;
+        prazo.tv_sec += (time_t)segundos;
+        prazo.tv_nsec = (long)((segundos - (double)(time_t)segundos) * 1e9);
+
+        // Espera o intervalo (timedwait com erro = prazo esgotado) ou o pedido de parada
+        while (!exportador.parar) {
+            if (pthread_cond_timedwait(&exportador.condicao, &exportador.trava, &prazo) != 0) {
+                break;
+            }
+        }
+        if (!exportador.parar) {
+            pthread_mutex_unlock(&exportador.trava);
+            gravarMetricas(exportador.caminho, exportador.formato);
+            pthread_mutex_lock(&exportador.trava);
+        }
+    }
+    pthread_mutex_unlock(&exportador.trava);
+
+    gravarMetricas(exportador.caminho, exportador.formato);  // Totais finais
+    return NULL;
+}
+
+/*
+ * Função: iniciarExportacaoMetricas
+ * Propósito: Inicia uma thread que regrava o arquivo de métricas periodicamente
+ * Parâmetros:
+ *   - caminho: arquivo de destino (substituído a cada gravação)
+ *   - formato: METRICAS_JSON ou METRICAS_PROMETHEUS
+ *   - intervaloSegundos: tempo entre gravações (maior que zero)
+ * Retorno: 0 em caso de sucesso, -1 se já houver exportação ativa, os parâmetros
+ *          forem inválidos ou a thread não puder ser criada
+ */
+int iniciarExportacaoMetricas(const char *caminho, FormatoMetricas formato, double intervaloSegundos) {
+    int erro = -1;
+
+    if (caminho == NULL || !(intervaloSegundos > 0.0)) {
+        return -1;
+    }
+    pthread_mutex_lock(&exportador.trava);
+    if (!exportador.ativo && (exportador.caminho = malloc(strlen(caminho) + 1)) != NULL) {
+        strcpy(exportador.caminho, caminho);
+        exportador.formato = formato;
+        exportador.intervalo = intervaloSegundos;
+        exportador.parar = 0;
+        if (pthread_create(&exportador.thread, NULL, executarExportador, NULL) == 0) {
+            exportador.ativo = 1;
+            erro = 0;
+        } else {
+            free(exportador.caminho);
+            exportador.caminho = NULL;
+        }
+    }
+    pthread_mutex_unlock(&exportador.trava);
+    return erro;
+}
+
+/*
+ * Função: pararExportacaoMetricas
+ * Propósito: Encerra a exportação periódica, gravando os totais finais
+ * Retorno: void (não retorna valor)
+ */
+void pararExportacaoMetricas(void) {
+    pthread_mutex_lock(&exportador.trava);
+    if (!exportador.ativo) {
+        pthread_mutex_unlock(&exportador.trava);
+        return;
+    }
+    exportador.parar = 1;
+    pthread_cond_signal(&exportador.condicao);
+    pthread_mutex_unlock(&exportador.trava);
+
+    pthread_join(exportador.thread, NULL);
+    pthread_mutex_lock(&exportador.trava);
+    free(exportador.caminho);
+    exportador.caminho = NULL;
+    exportador.ativo = 0;
+    pthread_mutex_unlock(&exportador.trava);
+}
@@ -0,0 +1,511 @@
+/*
+ * Arquivo: src/layouts.c
+ * Descrição: Enumeração exaustiva e paralela dos layouts da frota, com frequências
+ *            por célula e numeração (posição <-> layout) de todos os layouts
+ */
+
+#include "batalha_naval_interno.h"
+
+#include <stdatomic.h>
+
+// ========== ENUMERAÇÃO EXAUSTIVA DE LAYOUTS ==========
+
+/*
+ * A enumeração escolhe os navios em ordem crescente de índice na tabela de
+ * posicionamentos, então cada layout aparece uma única vez. A árvore de busca é
+ * dividida pelo par (primeiro, segundo navio): uma tarefa por primeiro navio
+ * abre, na fila da própria thread, uma tarefa para cada segundo navio
+ * compatível, e as threads ociosas roubam essas tarefas. Os dois últimos níveis
+ * são resolvidos com conjuntos de bits: os candidatos ao quarto navio são a
+ * interseção dos compatíveis com os três primeiros, e o seu popcount já é a
+ * quantidade de layouts que completam o trio.
+ */
+
+#define VERSAO_PRIORI 1  // Versão do arquivo de distribuição a priori
+
+typedef uint64_t ConjuntoPosicionamentos[PALAVRAS_CONJUNTO_POSICIONAMENTOS];
+
+/*
+ * Tipo: ContextoEnumeracao
+ * Campos:
+ *   - enumeracao: resultado em construção (cada tarefa escreve só o seu par
+ *                 em acumuladoPar)
+ *   - pool: pool onde as tarefas dos pares são abertas
+ *   - porPosicionamento: somas de todas as tarefas
+ */
+typedef struct {
+    EnumeracaoLayouts *enumeracao;
+    PoolTrabalho *pool;
+    _Atomic uint64_t porPosicionamento[MAX_POSICIONAMENTOS];
+} ContextoEnumeracao;
+
+// Um ramo da árvore de busca: o primeiro navio e, nas tarefas de par, o segundo
+typedef struct {
+    ContextoEnumeracao *contexto;
+    short primeiro;
+    short segundo;
+} TarefaEnumeracao;
+
+// Restringe o conjunto aos posicionamentos de índice maior que o informado
+static inline void manterPosteriores(ConjuntoPosicionamentos conjunto, int indice) {
+    int palavra = indice / 64;
+    for (int w = 0; w < palavra; w++) {
+        conjunto[w] = 0;
+    }
+    conjunto[palavra] &= (indice % 64 == 63) ? 0 : ~0ULL << (indice % 64 + 1);
+}
+
+static inline int contarConjunto(const ConjuntoPosicionamentos conjunto) {
+    int total = 0;
+    for (int w = 0; w < PALAVRAS_CONJUNTO_POSICIONAMENTOS; w++) {
+        total += __builtin_popcountll(conjunto[w]);
+    }
+    return total;
+}
+
+static inline int contemPosicionamento(const ConjuntoPosicionamentos conjunto, int indice) {
+    return (int)((conjunto[indice / 64] >> (indice % 64)) & 1);
+}
+
+// Candidatos a próximo navio: os compatíveis com "indice" dentro de base, depois dele
+static inline void candidatosApos(const EnumeracaoLayouts *enumeracao,
+                                  const ConjuntoPosicionamentos base, int indice,
+                                  ConjuntoPosicionamentos destino) {
+    for (int w = 0; w < PALAVRAS_CONJUNTO_POSICIONAMENTOS; w++) {
+        destino[w] = base[w] & enumeracao->compativeis[indice][w];
+    }
+    manterPosteriores(destino, indice);
+}
+
+/*
+ * Função: enumerarPar
+ * Propósito: Tarefa do pool: conta todos os layouts com o primeiro e o segundo
+ *            navio fixados
+ * Parâmetros:
+ *   - argumento: TarefaEnumeracao com os dois navios
+ * Retorno: void (não retorna valor)
+ * Nota: Os contadores ficam em um vetor local e vão para o contexto de uma vez,
+ *       no fim da tarefa, para que as threads não disputem as mesmas linhas de cache.
+ */
+static void enumerarPar(void *argumento) {
+    const TarefaEnumeracao *tarefa = argumento;
+    EnumeracaoLayouts *enumeracao = tarefa->contexto->enumeracao;
+    uint64_t local[MAX_POSICIONAMENTOS] = {0};
+    ConjuntoPosicionamentos terceiros, quartos;
+    uint64_t total = 0;
+
+    candidatosApos(enumeracao, enumeracao->compativeis[tarefa->primeiro], tarefa->segundo,
+                   terceiros);
+    for (int w = 0; w < PALAVRAS_CONJUNTO_POSICIONAMENTOS; w++) {
+        for (uint64_t bits = terceiros[w]; bits; bits &= bits - 1) {
+            int terceiro = w * 64 + __builtin_ctzll(bits);
+            int quantidade;
+
+            candidatosApos(enumeracao, terceiros, terceiro, quartos);
+            quantidade = contarConjunto(quartos);
+            if (quantidade == 0) {
+                continue;
+            }
+            total += (uint64_t)quantidade;
+            local[terceiro] += (uint64_t)quantidade;
+            for (int v = terceiro / 64; v < PALAVRAS_CONJUNTO_POSICIONAMENTOS; v++) {
+                for (uint64_t resto = quartos[v]; resto; resto &= resto - 1) {
+                    local[v * 64 + __builtin_ctzll(resto)]++;
+                }
+            }
+        }
+    }
+    local[tarefa->primeiro] += total;
+    local[tarefa->segundo] += total;
+
+    // Cada par tem a sua própria entrada: nenhuma outra tarefa escreve nela
+    enumeracao->acumuladoPar[tarefa->primeiro * enumeracao->quantidade + tarefa->segundo] = total;
+    for (int p = tarefa->segundo; p < enumeracao->quantidade; p++) {
+        if (local[p] != 0) {
+            atomic_fetch_add_explicit(&tarefa->contexto->porPosicionamento[p], local[p],
+                                      memory_order_relaxed);
+        }
+    }
+    if (local[tarefa->primeiro] != 0) {
+        atomic_fetch_add_explicit(&tarefa->contexto->porPosicionamento[tarefa->primeiro],
+                                  local[tarefa->primeiro], memory_order_relaxed);
+    }
+}
+
+/*
+ * Função: abrirPrimeiro
+ * Propósito: Tarefa do pool: abre uma tarefa de par para cada segundo navio
+ *            compatível com o primeiro
+ * Parâmetros:
+ *   - argumento: TarefaEnumeracao com o primeiro navio (a tabela de tarefas tem
+ *                uma entrada por par, na posição primeiro * quantidade + segundo)
+ * Retorno: void (não retorna valor)
+ * Nota: As tarefas vão para a fila da própria thread; se não houver memória para
+ *       agendar uma delas, ela é executada aqui mesmo.
+ */
+static void abrirPrimeiro(void *argumento) {
+    TarefaEnumeracao *tarefas = argumento;
+    ContextoEnumeracao *contexto = tarefas->contexto;
+    const EnumeracaoLayouts *enumeracao = contexto->enumeracao;
+    int primeiro = tarefas->primeiro;
+    ConjuntoPosicionamentos segundos;
+
+    memcpy(segundos, enumeracao->compativeis[primeiro], sizeof(segundos));
+    manterPosteriores(segundos, primeiro);
+    for (int w = 0; w < PALAVRAS_CONJUNTO_POSICIONAMENTOS; w++) {
+        for (uint64_t bits = segundos[w]; bits; bits &= bits - 1) {
+            int segundo = w * 64 + __builtin_ctzll(bits);
+            TarefaEnumeracao *tarefa = &tarefas[segundo - primeiro];
+
+            tarefa->contexto = contexto;
+            tarefa->primeiro = (short)primeiro;
+            tarefa->segundo = (short)segundo;
+            if (enviarTarefa(contexto->pool, enumerarPar, tarefa) != 0) {
+                enumerarPar(tarefa);
+            }
+        }
+    }
+}
+
+/*
+ * Função: enumerarLayouts
+ * Propósito: Percorre todos os layouts legais da frota, em paralelo
+ * Parâmetros:
+ *   - enumeracao: recebe o resultado (liberado com liberarEnumeracaoLayouts)
+ *   - threads: threads de trabalho (0 usa todos os núcleos disponíveis)
+ * Retorno: 0 em caso de sucesso, -1 se faltar memória ou não for possível criar
+ *          as threads (nada fica alocado nesse caso)
+ */
+int enumerarLayouts(EnumeracaoLayouts *enumeracao, int threads) {
+    ContextoEnumeracao *contexto;
+    TarefaEnumeracao *tarefas;
+    size_t pares;
+    int n;
+
+    inicializarTabelaPosicionamentos();
+    n = quantidadePosicionamentos;
+    pares = (size_t)n * (size_t)n;
+
+    memset(enumeracao, 0, sizeof(*enumeracao));
+    enumeracao->quantidade = n;
+    enumeracao->acumuladoPrimeiro = calloc((size_t)n + 1, sizeof(uint64_t));
+    enumeracao->acumuladoPar = calloc(pares, sizeof(uint64_t));
+    enumeracao->compativeis = calloc((size_t)n, sizeof(ConjuntoPosicionamentos));
+    tarefas = malloc(pares * sizeof(TarefaEnumeracao));
+    contexto = malloc(sizeof(ContextoEnumeracao));
+    if (enumeracao->acumuladoPrimeiro == NULL || enumeracao->acumuladoPar == NULL ||
+        enumeracao->compativeis == NULL || tarefas == NULL || contexto == NULL) {
+        free(tarefas);
+        free(contexto);
+        liberarEnumeracaoLayouts(enumeracao);
+        return -1;
+    }
+
+    for (int a = 0; a < n; a++) {
+        for (int b = 0; b < n; b++) {
+            if (!bitboardTemInterseccao(tabelaPosicionamentos[a].ocupacao,
+                                        tabelaPosicionamentos[b].ocupacao)) {
+                enumeracao->compativeis[a][b / 64] |= 1ULL << (b % 64);
+            }
+        }
+    }
+
+    contexto->enumeracao = enumeracao;
+    for (int p = 0; p < MAX_POSICIONAMENTOS; p++) {
+        atomic_init(&contexto->porPosicionamento[p], 0);
+    }
+    contexto->pool = criarPoolTrabalho(threads);
+    if (contexto->pool == NULL) {
+        free(tarefas);
+        free(contexto);
+        liberarEnumeracaoLayouts(enumeracao);
+        return -1;
+    }
+
+    // A tarefa do primeiro navio p usa a linha p da tabela de tarefas; o próprio
+    // par (p, p) nunca é um layout, então a sua entrada guarda a tarefa de abertura
+    for (int p = 0; p < n; p++) {
+        TarefaEnumeracao *linha = &tarefas[(size_t)p * (size_t)n + (size_t)p];
+        linha->contexto = contexto;
+        linha->primeiro = (short)p;
+        linha->segundo = (short)p;
+        if (enviarTarefa(contexto->pool, abrirPrimeiro, linha) != 0) {
+            abrirPrimeiro(linha);
+        }
+    }
+    aguardarPoolTrabalho(contexto->pool);
+    enumeracao->roubos = roubosPoolTrabalho(contexto->pool);
+    destruirPoolTrabalho(contexto->pool);
+
+    // Totais por par viram somas acumuladas por linha, e as linhas, o acumulado geral
+    for (int p = 0; p < n; p++) {
+        uint64_t *linha = &enumeracao->acumuladoPar[(size_t)p * (size_t)n];
+        uint64_t soma = 0;
+        for (int s = 0; s < n; s++) {
+            uint64_t totalPar = linha[s];
+            linha[s] = soma;
+            soma += totalPar;
+        }
+        enumeracao->acumuladoPrimeiro[p + 1] = enumeracao->acumuladoPrimeiro[p] + soma;
+    }
+    enumeracao->total = enumeracao->acumuladoPrimeiro[n];
+
+    for (int p = 0; p < n; p++) {
+        enumeracao->porPosicionamento[p] = atomic_load(&contexto->porPosicionamento[p]);
+        for (int k = 0; k < TAMANHO_NAVIO; k++) {
+            enumeracao->frequencia[tabelaPosicionamentos[p].celulas[k]] +=
+                enumeracao->porPosicionamento[p];
+        }
+    }
+
+    free(tarefas);
+    free(contexto);
+    return 0;
+}
+
+/*
+ * Função: posicaoLayout
+ * Propósito: Número de um layout na ordem da enumeração
+ * Parâmetros:
+ *   - enumeracao: enumeração concluída
+ *   - navios: índices dos navios na tabela de posicionamentos (qualquer ordem)
+ * Retorno: posição de 0 a total - 1, ou UINT64_MAX se o layout não for legal
+ */
+uint64_t posicaoLayout(const EnumeracaoLayouts *enumeracao, const short navios[NAVIOS_LAYOUT]) {
+    short ordenados[NAVIOS_LAYOUT];
+    ConjuntoPosicionamentos terceiros, quartos;
+    uint64_t posicao;
+    int n = enumeracao->quantidade;
+
+    // Ordenação por inserção dos quatro índices
+    for (int i = 0; i < NAVIOS_LAYOUT; i++) {
+        int j = i;
+        if (navios[i] < 0 || navios[i] >= n) {
+            return UINT64_MAX;
+        }
+        while (j > 0 && ordenados[j - 1] > navios[i]) {
+            ordenados[j] = ordenados[j - 1];
+            j--;
+        }
+        ordenados[j] = navios[i];
+    }
+
+    candidatosApos(enumeracao, enumeracao->compativeis[ordenados[0]], ordenados[1], terceiros);
+    if (!contemPosicionamento(enumeracao->compativeis[ordenados[0]], ordenados[1]) ||
+        !contemPosicionamento(terceiros, ordenados[2])) {
+        return UINT64_MAX;
+    }
+    candidatosApos(enumeracao, terceiros, ordenados[2], quartos);
+    if (!contemPosicionamento(quartos, ordenados[3])) {
+        return UINT64_MAX;
+    }
+
+    posicao = enumeracao->acumuladoPrimeiro[ordenados[0]] +
+              enumeracao->acumuladoPar[ordenados[0] * n + ordenados[1]];
+    // Layouts com o mesmo par e um terceiro navio anterior
+    for (int w = 0; w < PALAVRAS_CONJUNTO_POSICIONAMENTOS; w++) {
+        for (uint64_t bits = terceiros[w]; bits; bits &= bits - 1) {
+            int terceiro = w * 64 + __builtin_ctzll(bits);
+            ConjuntoPosicionamentos anteriores;
+            if (terceiro >= ordenados[2]) {
+                break;
+            }
+            candidatosApos(enumeracao, terceiros, terceiro, anteriores);
+            posicao += (uint64_t)contarConjunto(anteriores);
+        }
+    }
+    // Quartos navios anteriores com o mesmo trio
+    for (int w = 0; w <= ordenados[3] / 64; w++) {
+        uint64_t bits = quartos[w];
+        if (w == ordenados[3] / 64) {
+            bits &= (1ULL << (ordenados[3] % 64)) - 1;
+        }
+        posicao += (uint64_t)__builtin_popcountll(bits);
+    }
+    return posicao;
+}
+
+/*
+ * Função: layoutNaPosicao
+ * Propósito: Layout de um número da enumeração (inversa de posicaoLayout)
+ * Parâmetros:
+ *   - enumeracao: enumeração concluída
+ *   - posicao: número de 0 a total - 1
+ *   - navios: recebe os índices dos navios, em ordem crescente
+ * Retorno: 0 em caso de sucesso, -1 se a posição estiver fora do intervalo
+ * Lógica: Busca binária nos acumulados do primeiro navio e do par; os dois
+ *         últimos navios saem da contagem dos candidatos, como na enumeração.
+ */
+int layoutNaPosicao(const EnumeracaoLayouts *enumeracao, uint64_t posicao,
+                    short navios[NAVIOS_LAYOUT]) {
+    const uint64_t *linha;
+    ConjuntoPosicionamentos terceiros, quartos;
+    int n = enumeracao->quantidade;
+    int inicio, fim;
+
+    if (posicao >= enumeracao->total) {
+        return -1;
+    }
+
+    // Último primeiro navio cujo acumulado não passa da posição
+    inicio = 0;
+    fim = n - 1;
+    while (inicio < fim) {
+        int meio = inicio + (fim - inicio + 1) / 2;
+        if (enumeracao->acumuladoPrimeiro[meio] <= posicao) {
+            inicio = meio;
+        } else {
+            fim = meio - 1;
+        }
+    }
+    navios[0] = (short)inicio;
+    posicao -= enumeracao->acumuladoPrimeiro[inicio];
+
+    // O mesmo para o segundo navio, dentro da linha do primeiro
+    linha = &enumeracao->acumuladoPar[navios[0] * n];
+    inicio = 0;
+    fim = n - 1;
+    while (inicio < fim) {
+        int meio = inicio + (fim - inicio + 1) / 2;
+        if (linha[meio] <= posicao) {
+            inicio = meio;
+        } else {
+            fim = meio - 1;
+        }
+    }
+    navios[1] = (short)inicio;
+    posicao -= linha[inicio];
+
+    candidatosApos(enumeracao, enumeracao->compativeis[navios[0]], navios[1], terceiros);
+    for (int w = 0; w < PALAVRAS_CONJUNTO_POSICIONAMENTOS; w++) {
+        for (uint64_t bits = terceiros[w]; bits; bits &= bits - 1) {
+            int terceiro = w * 64 + __builtin_ctzll(bits);
+            uint64_t quantidade;
+
+            candidatosApos(enumeracao, terceiros, terceiro, quartos);
+            quantidade = (uint64_t)contarConjunto(quartos);
+            if (posicao >= quantidade) {
+                posicao -= quantidade;
+                continue;
+            }
+            navios[2] = (short)terceiro;
+            // O quarto navio é o candidato de ordem "posicao"
+            for (int v = 0; v < PALAVRAS_CONJUNTO_POSICIONAMENTOS; v++) {
+                uint64_t resto = quartos[v];
+                int naPalavra = __builtin_popcountll(resto);
+                if (posicao >= (uint64_t)naPalavra) {
+                    posicao -= (uint64_t)naPalavra;
+                    continue;
+                }
+                while (posicao-- > 0) {
+                    resto &= resto - 1;
+                }
+                navios[3] = (short)(v * 64 + __builtin_ctzll(resto));
+                return 0;
+            }
+        }
+    }
+    return -1;  // Inalcançável com uma enumeração consistente
+}
+
+/*
+ * Função: prioriDaEnumeracao
+ * Propósito: Converte a enumeração na distribuição a priori do solucionador
+ *            (o resultado de resolverConfiguracoes sem nenhum tiro)
+ * Parâmetros:
+ *   - enumeracao: enumeração concluída
+ *   - priori: recebe total, cobertura e probabilidade de cada célula
+ * Retorno: void (não retorna valor)
+ */
+void prioriDaEnumeracao(const EnumeracaoLayouts *enumeracao, ResultadoSolucionador *priori) {
+    priori->total = enumeracao->total;
+    for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+        priori->cobertura[c] = enumeracao->frequencia[c];
+        priori->probabilidade[c] = enumeracao->total > 0
+            ? (double)enumeracao->frequencia[c] / (double)enumeracao->total
+            : 0.0;
+    }
+}
+
+/*
+ * Função: gravarPriori
+ * Propósito: Grava a distribuição a priori em um arquivo de texto
+ * Parâmetros:
+ *   - caminho: arquivo de destino (substituído)
+ *   - priori: total e cobertura de cada célula
+ * Retorno: 0 em caso de sucesso, -1 em caso de erro de escrita
+ * Formato: "priori <versao> <total>" seguido de TAMANHO_TABULEIRO linhas com a
+ *          cobertura das células de cada linha do tabuleiro
+ */
+int gravarPriori(const char *caminho, const ResultadoSolucionador *priori) {
+    FILE *arquivo = fopen(caminho, "w");
+    int erro;
+
+    if (arquivo == NULL) {
+        return -1;
+    }
+    erro = fprintf(arquivo, "priori %d %llu\n", VERSAO_PRIORI,
+                   (unsigned long long)priori->total) < 0;
+    for (int i = 0; i < TAMANHO_TABULEIRO && !erro; i++) {
+        for (int j = 0; j < TAMANHO_TABULEIRO && !erro; j++) {
+            erro = fprintf(arquivo, j ? " %llu" : "%llu",
+                           (unsigned long long)priori->cobertura[INDICE_CELULA(i, j)]) < 0;
+        }
+        erro = erro || fputc('\n', arquivo) == EOF;
+    }
+    if (fclose(arquivo) != 0) {
+        erro = 1;
+    }
+    return erro ? -1 : 0;
+}
+
+/*
+ * Função: carregarPriori
+ * Propósito: Lê um arquivo escrito por gravarPriori
+ * Parâmetros:
+ *   - caminho: arquivo de origem
+ *   - priori: recebe total, cobertura e probabilidade de cada célula
+ * Retorno: 0 em caso de sucesso, -1 se o arquivo não existir ou for inválido
+ */
+int carregarPriori(const char *caminho, ResultadoSolucionador *priori) {
+    FILE *arquivo = fopen(caminho, "r");
+    unsigned long long valor;
+    int versao;
+    int erro;
+
+    if (arquivo == NULL) {
+        return -1;
+    }
+    erro = fscanf(arquivo, "priori %d %llu", &versao, &valor) != 2 || versao != VERSAO_PRIORI;
+    priori->total = valor;
+    for (int c = 0; c < CELULAS_TABULEIRO && !erro; c++) {
+        erro = fscanf(arquivo, "%llu", &valor) != 1 || valor > priori->total;
+        priori->cobertura[c] = valor;
+    }
+    fclose(arquivo);
+    if (erro) {
+        return -1;
+    }
+    for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+        priori->probabilidade[c] = priori->total > 0
+            ? (double)priori->cobertura[c] / (double)priori->total
+            : 0.0;
+    }
+    return 0;
+}
+
+/*
+ * Função: liberarEnumeracaoLayouts
+ * Propósito: Libera as tabelas da numeração
+ * Parâmetros:
+ *   - enumeracao: enumeração (os totais e frequências continuam válidos)
+ * Retorno: void (não retorna valor)
+ */
+void liberarEnumeracaoLayouts(EnumeracaoLayouts *enumeracao) {
+    free(enumeracao->acumuladoPrimeiro);
+    free(enumeracao->acumuladoPar);
+    free(enumeracao->compativeis);
+    enumeracao->acumuladoPrimeiro = NULL;
+    enumeracao->acumuladoPar = NULL;
+    enumeracao->compativeis = NULL;
+}
@@ -0,0 +1,107 @@
+/*
+ * Arquivo: src/navios.c
+ * Descrição: Tabela de navios: identidade de cada navio e resolução de tiros em O(1)
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== TABELA DE NAVIOS ==========
+
+/*
+ * Função: iniciarTabelaNavios
+ * Propósito: Esvazia a tabela (nenhum navio, nenhuma célula associada)
+ * Parâmetros:
+ *   - tabela: tabela de navios
+ * Retorno: void (não retorna valor)
+ */
+void iniciarTabelaNavios(TabelaNavios *tabela) {
+    memset(tabela->navioDaCelula, SEM_NAVIO, sizeof(tabela->navioDaCelula));
+    tabela->quantidadeNavios = 0;
+    tabela->naviosRestantes = 0;
+}
+
+/*
+ * Função: adicionarNavioRastreado
+ * Propósito: Registra um navio recém-posicionado e associa suas células a ele
+ * Parâmetros:
+ *   - tabela: tabela de navios
+ *   - posicionamento: entrada da tabela de posicionamentos ocupada pelo navio
+ * Retorno: identificador do navio (0, 1, 2...), ou -1 se a tabela estiver cheia
+ *          ou alguma célula já pertencer a outro navio
+ * Nota: Deve acompanhar cada posicionarNavioBits: a tabela só conhece os navios
+ *       registrados aqui.
+ */
+int adicionarNavioRastreado(TabelaNavios *tabela, const Posicionamento *posicionamento) {
+    int id = tabela->quantidadeNavios;
+    NavioRastreado *navio;
+
+    if (id >= MAX_NAVIOS_TABULEIRO) {
+        return -1;
+    }
+    for (int i = 0; i < TAMANHO_NAVIO; i++) {
+        if (tabela->navioDaCelula[posicionamento->celulas[i]] != SEM_NAVIO) {
+            return -1;
+        }
+    }
+
+    navio = &tabela->navios[id];
+    navio->ocupacao = posicionamento->ocupacao;
+    navio->restantes = TAMANHO_NAVIO;
+    for (int i = 0; i < TAMANHO_NAVIO; i++) {
+        navio->celulas[i] = posicionamento->celulas[i];
+        tabela->navioDaCelula[posicionamento->celulas[i]] = (unsigned char)id;
+    }
+    tabela->quantidadeNavios++;
+    tabela->naviosRestantes++;
+    return id;
+}
+
+/*
+ * Função: rastrearFrota
+ * Propósito: Recria a tabela a partir de uma frota sorteada por gerarFrota
+ * Parâmetros:
+ *   - tabela: tabela de navios
+ *   - frota: frota completa (navios disjuntos)
+ * Retorno: void (não retorna valor)
+ */
+void rastrearFrota(TabelaNavios *tabela, const Frota *frota) {
+    iniciarTabelaNavios(tabela);
+    for (int n = 0; n < QUANTIDADE_NAVIOS; n++) {
+        adicionarNavioRastreado(tabela, frota->navios[n]);
+    }
+}
+
+/*
+ * Função: resolverTiro
+ * Propósito: Registra um tiro e informa acerto, afundamento e fim de jogo sem
+ *            percorrer o tabuleiro
+ * Parâmetros:
+ *   - tabela: tabela de navios do tabuleiro
+ *   - tabuleiro: tabuleiro em bits (recebe o tiro na camada de tiros)
+ *   - celula: índice da célula atingida (INDICE_CELULA)
+ *   - navio: recebe o identificador do navio atingido, ou -1 na água; pode ser NULL
+ * Retorno: ResultadoTiro correspondente
+ * Lógica: A célula leva direto ao navio (navioDaCelula) e o contador de células
+ *         restantes do navio, ao chegar a 0, desconta um navio da frota.
+ */
+ResultadoTiro resolverTiro(TabelaNavios *tabela, TabuleiroBits *tabuleiro, int celula,
+                           int *navio) {
+    int id = tabela->navioDaCelula[celula];
+
+    if (navio != NULL) {
+        *navio = id != SEM_NAVIO ? id : -1;
+    }
+    if (bitboardContemCelula(tabuleiro->tiros, celula)) {
+        return TIRO_REPETIDO;
+    }
+    tabuleiro->tiros = bitboardOu(tabuleiro->tiros, bitboardCelula(celula));
+    tabuleiro->hash ^= hashCamadaZobrist(ZOBRIST_TIROS, bitboardCelula(celula));
+
+    if (id == SEM_NAVIO) {
+        return TIRO_AGUA;
+    }
+    if (--tabela->navios[id].restantes > 0) {
+        return TIRO_ACERTO;
+    }
+    return --tabela->naviosRestantes > 0 ? TIRO_AFUNDOU : TIRO_FIM_DE_JOGO;
+}
@@ -0,0 +1,181 @@
+/*
+ * Arquivo: src/partida_dinamica.c
+ * Descrição: Partidas em tabuleiros dinâmicos, alocadas inteiras em uma arena
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== PARTIDAS EM ARENA ==========
+
+/*
+ * Função: iniciarPartidaDinamica
+ * Propósito: Aloca na arena tudo o que a partida usa e deixa o tabuleiro vazio
+ * Parâmetros:
+ *   - partida: partida a ser iniciada
+ *   - arena: arena de origem (tipicamente arenaDaThread())
+ *   - largura, altura: dimensões do tabuleiro
+ *   - frota: navios da partida (copiada para a arena)
+ *   - capacidadeEfeitos: máximo de efeitos de habilidade registrados
+ * Retorno: 0 em caso de sucesso, -1 se os parâmetros forem inválidos ou faltar
+ *          memória (nesse caso a arena volta ao estado anterior)
+ */
+int iniciarPartidaDinamica(PartidaDinamica *partida, Arena *arena, int largura, int altura,
+                           const EspecificacaoFrota *frota, int capacidadeEfeitos) {
+    size_t celulas;
+
+    partida->arena = arena;
+    partida->marca = marcarArena(arena);
+    if (capacidadeEfeitos < 0 ||
+        criarTabuleiroDinamicoNaArena(&partida->tabuleiro, arena, largura, altura) != 0) {
+        voltarArena(arena, partida->marca);
+        return -1;
+    }
+
+    celulas = (size_t)largura * (size_t)altura;
+    if (celulas > UINT32_MAX) {
+        voltarArena(arena, partida->marca);
+        return -1;  // Os tiros são registrados como índices de 32 bits
+    }
+    partida->frota = alocarArena(arena, sizeof(EspecificacaoFrota));
+    partida->atingidas = alocarArena(arena, (celulas + 63) / 64 * sizeof(uint64_t));
+    partida->tiros = alocarArena(arena, celulas * sizeof(uint32_t));
+    partida->efeitos = alocarArena(arena, (size_t)capacidadeEfeitos * sizeof(EfeitoHabilidade));
+    if (partida->frota == NULL || partida->atingidas == NULL || partida->tiros == NULL ||
+        partida->efeitos == NULL) {
+        voltarArena(arena, partida->marca);
+        return -1;
+    }
+
+    *partida->frota = *frota;
+    memset(partida->atingidas, 0, (celulas + 63) / 64 * sizeof(uint64_t));
+    partida->celulasRestantes = 0;
+    partida->quantidadeTiros = 0;
+    partida->quantidadeEfeitos = 0;
+    partida->capacidadeEfeitos = capacidadeEfeitos;
+    return 0;
+}
+
+/*
+ * Função: posicionarFrotaPartida
+ * Propósito: Sorteia e posiciona a frota da partida
+ * Parâmetros:
+ *   - partida: partida iniciada
+ *   - gerador: gerador pseudoaleatório
+ * Retorno: 0 em caso de sucesso, -1 se algum navio não couber (o tabuleiro
+ *          fica sem nenhum navio da frota e a partida pode tentar de novo)
+ */
+int posicionarFrotaPartida(PartidaDinamica *partida, GeradorAleatorio *gerador) {
+    if (posicionarFrotaDinamica(&partida->tabuleiro, partida->frota, gerador) != 0) {
+        return -1;
+    }
+    // Os navios não se sobrepõem: as células de navio são a soma dos tamanhos
+    for (int n = 0; n < partida->frota->quantidade; n++) {
+        partida->celulasRestantes += partida->frota->tamanhos[n];
+    }
+    return 0;
+}
+
+/*
+ * Função: aplicarEfeitoPartida
+ * Propósito: Aplica um efeito de habilidade ao tabuleiro e o registra no histórico
+ * Parâmetros:
+ *   - partida: partida iniciada
+ *   - efeito: forma e origem da área
+ * Retorno: 0 em caso de sucesso, -1 se o histórico de efeitos estiver cheio
+ */
+int aplicarEfeitoPartida(PartidaDinamica *partida, const EfeitoHabilidade *efeito) {
+    if (partida->quantidadeEfeitos >= partida->capacidadeEfeitos) {
+        return -1;
+    }
+    aplicarFormaDinamico(&partida->tabuleiro, efeito->forma, efeito->linha, efeito->coluna);
+    partida->efeitos[partida->quantidadeEfeitos++] = *efeito;
+    return 0;
+}
+
+/*
+ * Função: registrarTiroPartida
+ * Propósito: Registra um tiro no histórico e no mapa de células atingidas
+ * Parâmetros:
+ *   - partida: partida iniciada
+ *   - linha, coluna: célula atingida
+ * Retorno: TIRO_AGUA, TIRO_ACERTO, TIRO_FIM_DE_JOGO (última célula de navio) ou
+ *          TIRO_REPETIDO; -1 se a célula estiver fora do tabuleiro
+ * Nota: O tabuleiro dinâmico não guarda a identidade dos navios, então o
+ *       afundamento de cada navio não é informado.
+ */
+int registrarTiroPartida(PartidaDinamica *partida, int linha, int coluna) {
+    const TabuleiroDinamico *tabuleiro = &partida->tabuleiro;
+    size_t indice;
+    uint64_t bit;
+
+    if (linha < 0 || linha >= tabuleiro->altura || coluna < 0 || coluna >= tabuleiro->largura) {
+        return -1;
+    }
+    indice = (size_t)linha * (size_t)tabuleiro->largura + (size_t)coluna;
+    bit = (uint64_t)1 << (indice & 63);
+    if (partida->atingidas[indice >> 6] & bit) {
+        return TIRO_REPETIDO;
+    }
+
+    partida->atingidas[indice >> 6] |= bit;
+    partida->tiros[partida->quantidadeTiros++] = (uint32_t)indice;
+    if (*celulaDinamica(tabuleiro, linha, coluna) != NAVIO) {
+        return TIRO_AGUA;
+    }
+    return --partida->celulasRestantes > 0 ? TIRO_ACERTO : TIRO_FIM_DE_JOGO;
+}
+
+/*
+ * Função: encerrarPartidaDinamica
+ * Propósito: Descarta a partida inteira em O(1), devolvendo a arena à marca inicial
+ * Parâmetros:
+ *   - partida: partida iniciada (e a última iniciada nessa arena ainda em uso)
+ * Retorno: void (não retorna valor)
+ */
+void encerrarPartidaDinamica(PartidaDinamica *partida) {
+    voltarArena(partida->arena, partida->marca);
+}
+
+/*
+ * Função: jogarPartidaDinamica
+ * Propósito: Joga uma partida completa em um tabuleiro dinâmico com tiros em
+ *            ordem aleatória, sem nenhuma alocação fora da arena
+ * Parâmetros:
+ *   - gerador: gerador da thread (define frota e tiros)
+ *   - arena: arena de trabalho (volta ao estado inicial ao final)
+ *   - largura, altura: dimensões do tabuleiro
+ *   - frota: navios da partida
+ * Retorno: quantidade de tiros até afundar a frota, ou -1 se a partida não
+ *          puder ser montada
+ */
+long jogarPartidaDinamica(GeradorAleatorio *gerador, Arena *arena, int largura, int altura,
+                          const EspecificacaoFrota *frota) {
+    PartidaDinamica partida;
+    uint32_t *ordem;
+    uint32_t celulas;
+    long tiros = -1;
+
+    if (iniciarPartidaDinamica(&partida, arena, largura, altura, frota, 0) != 0) {
+        return -1;
+    }
+    celulas = (uint32_t)largura * (uint32_t)altura;
+    ordem = alocarArena(arena, (size_t)celulas * sizeof(uint32_t));
+    if (ordem != NULL && posicionarFrotaPartida(&partida, gerador) == 0) {
+        for (uint32_t c = 0; c < celulas; c++) {
+            ordem[c] = c;
+        }
+        // Embaralhamento de Fisher-Yates sorteado a cada tiro: nenhuma célula se repete
+        int resultado = partida.celulasRestantes > 0 ? TIRO_AGUA : TIRO_FIM_DE_JOGO;
+        for (uint32_t t = 0; t < celulas && resultado != TIRO_FIM_DE_JOGO; t++) {
+            uint32_t j = t + aleatorioAte(gerador, celulas - t);
+            uint32_t alvo = ordem[j];
+            ordem[j] = ordem[t];
+            ordem[t] = alvo;
+            resultado = registrarTiroPartida(&partida, (int)(alvo / (uint32_t)largura),
+                                             (int)(alvo % (uint32_t)largura));
+        }
+        tiros = partida.quantidadeTiros;
+    }
+    encerrarPartidaDinamica(&partida);
+    return tiros;
+}
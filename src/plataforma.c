@@ -0,0 +1,58 @@
+/*
+ * Arquivo: src/plataforma.c
+ * Descrição: Memória alinhada, relógio e núcleos de processamento (partes dependentes do sistema)
+ */
+
+#include "batalha_naval_interno.h"
+
+#include <time.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+// ========== FUNÇÕES DEPENDENTES DA PLATAFORMA ==========
+
+/*
+ * Função: alocarAlinhado
+ * Propósito: Aloca memória alinhada à linha de cache
+ * Parâmetros:
+ *   - tamanho: quantidade de bytes (arredondada para múltiplo de ALINHAMENTO_CACHE)
+ * Retorno: ponteiro para a memória, ou NULL se faltar memória.
+ *          Deve ser liberada com liberarAlinhado.
+ */
+void *alocarAlinhado(size_t tamanho) {
+    tamanho = (tamanho + ALINHAMENTO_CACHE - 1) / ALINHAMENTO_CACHE * ALINHAMENTO_CACHE;
+#ifdef _WIN32
+    return _aligned_malloc(tamanho ? tamanho : ALINHAMENTO_CACHE, ALINHAMENTO_CACHE);
+#else
+    return aligned_alloc(ALINHAMENTO_CACHE, tamanho ? tamanho : ALINHAMENTO_CACHE);
+#endif
+}
+
+// Libera memória obtida com alocarAlinhado
+void liberarAlinhado(void *memoria) {
+#ifdef _WIN32
+    _aligned_free(memoria);
+#else
+    free(memoria);
+#endif
+}
+
+// Relógio de parede em segundos, para medir a vazão
+double relogioSegundos(void) {
+    struct timespec agora;
+    timespec_get(&agora, TIME_UTC);
+    return (double)agora.tv_sec + (double)agora.tv_nsec * 1e-9;
+}
+
+// Quantidade de núcleos de processamento disponíveis
+int contarNucleos(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    return nucleos > 0 ? (int)nucleos : 1;
+#endif
+}
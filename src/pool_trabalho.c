@@ -0,0 +1,334 @@
+/*
+ * Arquivo: src/pool_trabalho.c
+ * Descrição: Pool de threads com uma fila dupla por thread e roubo de tarefas
+ */
+
+#include "batalha_naval_interno.h"
+
+#include <stdatomic.h>
+
+// ========== POOL DE TRABALHO COM ROUBO DE TAREFAS ==========
+
+#define CAPACIDADE_INICIAL_FILA 256  // Tarefas por fila antes do primeiro crescimento
+
+/*
+ * Tipo: Tarefa
+ * Campos:
+ *   - funcao: código da tarefa
+ *   - argumento: repassado a funcao
+ */
+typedef struct {
+    FuncaoTarefa funcao;
+    void *argumento;
+} Tarefa;
+
+/*
+ * Tipo: FilaTrabalho
+ * Propósito: Fila dupla circular de uma thread de trabalho
+ * Campos:
+ *   - trava: protege a fila (disputada apenas pela dona e por eventuais ladras)
+ *   - tarefas: vetor circular com capacidade potência de 2
+ *   - inicio: posição da tarefa mais antiga (ponto de roubo)
+ *   - quantidade: tarefas na fila; a mais nova fica em inicio + quantidade - 1
+ */
+typedef struct {
+    _Alignas(ALINHAMENTO_CACHE) pthread_mutex_t trava;
+    Tarefa *tarefas;
+    size_t capacidade;
+    size_t inicio;
+    size_t quantidade;
+} FilaTrabalho;
+
+/*
+ * Tipo: PoolTrabalho
+ * Campos:
+ *   - filas: uma fila por thread de trabalho
+ *   - contextos: identificação de cada thread (pool e índice da fila)
+ *   - ids: threads criadas
+ *   - threads: quantidade de threads
+ *   - enfileiradas: tarefas esperando em alguma fila
+ *   - pendentes: tarefas enviadas e ainda não concluídas (inclui as em execução)
+ *   - dormindo: threads bloqueadas em sinalTarefa
+ *   - proximaFila: rodízio das tarefas enviadas de fora do pool
+ *   - roubos: tarefas executadas por uma thread diferente da que as recebeu
+ *   - travaSono, sinalTarefa, sinalOcioso: sono das threads sem trabalho e espera
+ *                                          de aguardarPoolTrabalho
+ *   - encerrar: pedido de término feito por destruirPoolTrabalho
+ */
+struct PoolTrabalho {
+    FilaTrabalho *filas;
+    struct ContextoTrabalhador *contextos;
+    pthread_t *ids;
+    int threads;
+    _Alignas(ALINHAMENTO_CACHE) atomic_long enfileiradas;
+    atomic_long pendentes;
+    atomic_int dormindo;
+    atomic_uint proximaFila;
+    atomic_llong roubos;
+    pthread_mutex_t travaSono;
+    pthread_cond_t sinalTarefa;
+    pthread_cond_t sinalOcioso;
+    int encerrar;
+};
+
+/*
+ * Tipo: ContextoTrabalhador
+ * Propósito: Identifica, em cada thread, o pool e a fila que ela possui
+ */
+typedef struct ContextoTrabalhador {
+    PoolTrabalho *pool;
+    int indice;
+} ContextoTrabalhador;
+
+static _Thread_local ContextoTrabalhador trabalhadorAtual = {NULL, -1};
+
+// Insere no fim da fila, dobrando a capacidade se necessário (com a trava já obtida)
+static int inserirNoFim(FilaTrabalho *fila, Tarefa tarefa) {
+    if (fila->quantidade == fila->capacidade) {
+        size_t novaCapacidade = fila->capacidade * 2;
+        Tarefa *novas = malloc(novaCapacidade * sizeof(Tarefa));
+        if (novas == NULL) {
+            return -1;
+        }
+        // Desenrola o vetor circular para o início do novo vetor
+        for (size_t i = 0; i < fila->quantidade; i++) {
+            novas[i] = fila->tarefas[(fila->inicio + i) & (fila->capacidade - 1)];
+        }
+        free(fila->tarefas);
+        fila->tarefas = novas;
+        fila->capacidade = novaCapacidade;
+        fila->inicio = 0;
+    }
+    fila->tarefas[(fila->inicio + fila->quantidade) & (fila->capacidade - 1)] = tarefa;
+    fila->quantidade++;
+    return 0;
+}
+
+// Retira a tarefa mais nova (dona) ou a mais antiga (ladra); retorna 0 se a fila está vazia
+static int retirarTarefa(PoolTrabalho *pool, FilaTrabalho *fila, int doInicio, Tarefa *tarefa) {
+    int encontrou = 0;
+
+    pthread_mutex_lock(&fila->trava);
+    if (fila->quantidade > 0) {
+        if (doInicio) {
+            *tarefa = fila->tarefas[fila->inicio];
+            fila->inicio = (fila->inicio + 1) & (fila->capacidade - 1);
+        } else {
+            *tarefa = fila->tarefas[(fila->inicio + fila->quantidade - 1) & (fila->capacidade - 1)];
+        }
+        fila->quantidade--;
+        atomic_fetch_sub(&pool->enfileiradas, 1);
+        encontrou = 1;
+    }
+    pthread_mutex_unlock(&fila->trava);
+    return encontrou;
+}
+
+// Busca trabalho: primeiro na própria fila, depois nas demais, a partir da vizinha
+static int buscarTarefa(PoolTrabalho *pool, int indice, Tarefa *tarefa) {
+    if (retirarTarefa(pool, &pool->filas[indice], 0, tarefa)) {
+        return 1;
+    }
+    for (int k = 1; k < pool->threads; k++) {
+        if (retirarTarefa(pool, &pool->filas[(indice + k) % pool->threads], 1, tarefa)) {
+            atomic_fetch_add(&pool->roubos, 1);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Corpo de cada thread de trabalho
+static void *executarTrabalhador(void *argumento) {
+    ContextoTrabalhador *contexto = argumento;
+    PoolTrabalho *pool = contexto->pool;
+    int indice = contexto->indice;
+    Tarefa tarefa;
+
+    trabalhadorAtual = *contexto;
+    for (;;) {
+        if (buscarTarefa(pool, indice, &tarefa)) {
+            tarefa.funcao(tarefa.argumento);
+            if (atomic_fetch_sub(&pool->pendentes, 1) == 1) {
+                pthread_mutex_lock(&pool->travaSono);
+                pthread_cond_broadcast(&pool->sinalOcioso);
+                pthread_mutex_unlock(&pool->travaSono);
+            }
+            continue;
+        }
+
+        // Sem trabalho em nenhuma fila: dorme até chegar uma tarefa ou o pedido de término.
+        // O contador dormindo é publicado antes de reler enfileiradas, e quem envia faz o
+        // contrário; assim pelo menos um dos dois vê o outro e nenhum sinal se perde.
+        pthread_mutex_lock(&pool->travaSono);
+        atomic_fetch_add(&pool->dormindo, 1);
+        while (atomic_load(&pool->enfileiradas) == 0 && !pool->encerrar) {
+            pthread_cond_wait(&pool->sinalTarefa, &pool->travaSono);
+        }
+        atomic_fetch_sub(&pool->dormindo, 1);
+        int sair = pool->encerrar && atomic_load(&pool->enfileiradas) == 0;
+        pthread_mutex_unlock(&pool->travaSono);
+        if (sair) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+// Encerra as threads já criadas e libera o pool inteiro
+static void liberarPool(PoolTrabalho *pool, int threadsCriadas) {
+    pthread_mutex_lock(&pool->travaSono);
+    pool->encerrar = 1;
+    pthread_cond_broadcast(&pool->sinalTarefa);
+    pthread_mutex_unlock(&pool->travaSono);
+    for (int t = 0; t < threadsCriadas; t++) {
+        pthread_join(pool->ids[t], NULL);
+    }
+
+    for (int t = 0; t < pool->threads; t++) {
+        pthread_mutex_destroy(&pool->filas[t].trava);
+        free(pool->filas[t].tarefas);
+    }
+    pthread_mutex_destroy(&pool->travaSono);
+    pthread_cond_destroy(&pool->sinalTarefa);
+    pthread_cond_destroy(&pool->sinalOcioso);
+    liberarAlinhado(pool->filas);
+    free(pool->contextos);
+    free(pool->ids);
+    liberarAlinhado(pool);
+}
+
+/*
+ * Função: criarPoolTrabalho
+ * Propósito: Cria o pool e inicia as threads de trabalho
+ * Parâmetros:
+ *   - threads: quantidade de threads (0 usa todos os núcleos disponíveis)
+ * Retorno: pool pronto, ou NULL se faltar memória ou não for possível criar as threads
+ */
+PoolTrabalho *criarPoolTrabalho(int threads) {
+    PoolTrabalho *pool = alocarAlinhado(sizeof(PoolTrabalho));
+    int criadas = 0;
+
+    if (pool == NULL) {
+        return NULL;
+    }
+    memset(pool, 0, sizeof(PoolTrabalho));
+    pool->threads = threads > 0 ? threads : contarNucleos();
+    pool->filas = alocarAlinhado(sizeof(FilaTrabalho) * (size_t)pool->threads);
+    pool->contextos = malloc(sizeof(ContextoTrabalhador) * (size_t)pool->threads);
+    pool->ids = malloc(sizeof(pthread_t) * (size_t)pool->threads);
+    if (pool->filas == NULL || pool->contextos == NULL || pool->ids == NULL) {
+        liberarAlinhado(pool->filas);
+        free(pool->contextos);
+        free(pool->ids);
+        liberarAlinhado(pool);
+        return NULL;
+    }
+
+    atomic_init(&pool->enfileiradas, 0);
+    atomic_init(&pool->pendentes, 0);
+    atomic_init(&pool->dormindo, 0);
+    atomic_init(&pool->proximaFila, 0);
+    atomic_init(&pool->roubos, 0);
+    pthread_mutex_init(&pool->travaSono, NULL);
+    pthread_cond_init(&pool->sinalTarefa, NULL);
+    pthread_cond_init(&pool->sinalOcioso, NULL);
+    for (int t = 0; t < pool->threads; t++) {
+        FilaTrabalho *fila = &pool->filas[t];
+        pthread_mutex_init(&fila->trava, NULL);
+        fila->tarefas = malloc(CAPACIDADE_INICIAL_FILA * sizeof(Tarefa));
+        fila->capacidade = CAPACIDADE_INICIAL_FILA;
+        fila->inicio = 0;
+        fila->quantidade = 0;
+        pool->contextos[t].pool = pool;
+        pool->contextos[t].indice = t;
+    }
+
+    for (; criadas < pool->threads; criadas++) {
+        if (pool->filas[criadas].tarefas == NULL ||
+            pthread_create(&pool->ids[criadas], NULL, executarTrabalhador,
+                           &pool->contextos[criadas]) != 0) {
+            liberarPool(pool, criadas);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+/*
+ * Função: enviarTarefa
+ * Propósito: Agenda uma tarefa no pool
+ * Parâmetros:
+ *   - pool: pool de destino
+ *   - funcao, argumento: tarefa a executar
+ * Retorno: 0 em caso de sucesso, -1 se faltar memória
+ * Nota: Dentro de uma tarefa do mesmo pool, a nova tarefa vai para a fila da
+ *       própria thread; de fora, as filas são escolhidas em rodízio.
+ */
+int enviarTarefa(PoolTrabalho *pool, FuncaoTarefa funcao, void *argumento) {
+    Tarefa tarefa = {funcao, argumento};
+    int indice = trabalhadorAtual.pool == pool
+                     ? trabalhadorAtual.indice
+                     : (int)(atomic_fetch_add(&pool->proximaFila, 1) % (unsigned)pool->threads);
+    FilaTrabalho *fila = &pool->filas[indice];
+    int erro;
+
+    atomic_fetch_add(&pool->pendentes, 1);
+    pthread_mutex_lock(&fila->trava);
+    erro = inserirNoFim(fila, tarefa);
+    if (!erro) {
+        atomic_fetch_add(&pool->enfileiradas, 1);
+    }
+    pthread_mutex_unlock(&fila->trava);
+    if (erro) {
+        atomic_fetch_sub(&pool->pendentes, 1);
+        return -1;
+    }
+
+    if (atomic_load(&pool->dormindo) > 0) {
+        pthread_mutex_lock(&pool->travaSono);
+        pthread_cond_signal(&pool->sinalTarefa);
+        pthread_mutex_unlock(&pool->travaSono);
+    }
+    return 0;
+}
+
+/*
+ * Função: aguardarPoolTrabalho
+ * Propósito: Bloqueia até que todas as tarefas enviadas (inclusive as criadas por
+ *            outras tarefas) tenham terminado
+ * Parâmetros:
+ *   - pool: pool de trabalho
+ * Retorno: void (não retorna valor)
+ * Nota: Não deve ser chamada de dentro de uma tarefa do próprio pool.
+ */
+void aguardarPoolTrabalho(PoolTrabalho *pool) {
+    pthread_mutex_lock(&pool->travaSono);
+    while (atomic_load(&pool->pendentes) > 0) {
+        pthread_cond_wait(&pool->sinalOcioso, &pool->travaSono);
+    }
+    pthread_mutex_unlock(&pool->travaSono);
+}
+
+// Quantidade de threads de trabalho do pool
+int threadsPoolTrabalho(const PoolTrabalho *pool) {
+    return pool->threads;
+}
+
+// Tarefas executadas por uma thread diferente da que as recebeu
+long long roubosPoolTrabalho(const PoolTrabalho *pool) {
+    return atomic_load(&((PoolTrabalho *)pool)->roubos);
+}
+
+/*
+ * Função: destruirPoolTrabalho
+ * Propósito: Termina as tarefas restantes, encerra as threads e libera o pool
+ * Parâmetros:
+ *   - pool: pool criado por criarPoolTrabalho (aceita NULL)
+ * Retorno: void (não retorna valor)
+ */
+void destruirPoolTrabalho(PoolTrabalho *pool) {
+    if (pool != NULL) {
+        liberarPool(pool, pool->threads);
+    }
+}
@@ -0,0 +1,168 @@
+/*
+ * Arquivo: src/posicionamentos.c
+ * Descrição: Tabela pré-calculada com todos os posicionamentos legais de navios
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== TABELA PRÉ-CALCULADA DE POSICIONAMENTOS ==========
+
+// Orientações na ordem usada pelos índices da tabela
+const char ORIENTACOES[QUANTIDADE_ORIENTACOES] = {'H', 'V', 'D', 'E'};
+
+// Tabela com todos os posicionamentos legais, ordenada pela célula inicial e depois
+// pela orientação. Como nenhum navio avança para cima, todas as células de um
+// posicionamento têm índice maior ou igual ao da sua célula inicial.
+Posicionamento tabelaPosicionamentos[MAX_POSICIONAMENTOS];
+int quantidadePosicionamentos = 0;
+
+// Índice na tabela para cada (linha, coluna, orientação), ou -1 se o navio não cabe
+short indicePosicionamento[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO][QUANTIDADE_ORIENTACOES];
+
+// Índice reverso: posicionamentos que cobrem cada célula
+short posicionamentosPorCelula[CELULAS_TABULEIRO][MAX_POSICIONAMENTOS_POR_CELULA];
+int quantidadePorCelula[CELULAS_TABULEIRO];
+static pthread_once_t geracaoTabelaPosicionamentos = PTHREAD_ONCE_INIT;
+
+/*
+ * Função: indiceOrientacao
+ * Propósito: Converte a letra da orientação no índice usado pela tabela
+ * Parâmetros:
+ *   - orientacao: 'H', 'V', 'D' ou 'E' (maiúsculas ou minúsculas)
+ * Retorno: índice de 0 a 3, ou -1 se a orientação for inválida
+ */
+static int indiceOrientacao(char orientacao) {
+    switch (orientacao) {
+        case 'H': case 'h': return 0;
+        case 'V': case 'v': return 1;
+        case 'D': case 'd': return 2;
+        case 'E': case 'e': return 3;
+        default: return -1;
+    }
+}
+
+/*
+ * Função: dilatarMascara
+ * Propósito: Expande um conjunto de células para incluir suas 8 vizinhas
+ * Parâmetros:
+ *   - mascara: conjunto de células original
+ * Retorno: conjunto original acrescido de todas as células vizinhas dentro do tabuleiro
+ */
+static Bitboard dilatarMascara(Bitboard mascara) {
+    Bitboard resultado = bitboardVazio();
+
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            if (!bitboardContemCelula(mascara, INDICE_CELULA(i, j))) {
+                continue;
+            }
+            // Marca o quadrado 3x3 ao redor da célula, respeitando os limites
+            for (int di = -1; di <= 1; di++) {
+                for (int dj = -1; dj <= 1; dj++) {
+                    int vi = i + di;
+                    int vj = j + dj;
+                    if (vi >= 0 && vi < TAMANHO_TABULEIRO && vj >= 0 && vj < TAMANHO_TABULEIRO) {
+                        resultado = bitboardOu(resultado, bitboardCelula(INDICE_CELULA(vi, vj)));
+                    }
+                }
+            }
+        }
+    }
+    return resultado;
+}
+
+// Preenche a tabela e os índices auxiliares (executada uma vez por pthread_once)
+static void gerarTabelaPosicionamentos(void) {
+    quantidadePosicionamentos = 0;
+    for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+        quantidadePorCelula[c] = 0;
+    }
+
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            for (int o = 0; o < QUANTIDADE_ORIENTACOES; o++) {
+                int passoLinha, passoColuna;
+                obterDeslocamentoOrientacao(ORIENTACOES[o], &passoLinha, &passoColuna);
+
+                // O navio cabe se a sua última célula estiver dentro do tabuleiro
+                int ultimaLinha = i + (TAMANHO_NAVIO - 1) * passoLinha;
+                int ultimaColuna = j + (TAMANHO_NAVIO - 1) * passoColuna;
+                if (ultimaLinha >= TAMANHO_TABULEIRO ||
+                    ultimaColuna < 0 || ultimaColuna >= TAMANHO_TABULEIRO) {
+                    indicePosicionamento[i][j][o] = -1;
+                    continue;
+                }
+
+                Posicionamento *p = &tabelaPosicionamentos[quantidadePosicionamentos];
+                p->ocupacao = mascaraNavio(i, j, TAMANHO_NAVIO, ORIENTACOES[o]);
+                p->halo = dilatarMascara(p->ocupacao);
+                p->linha = (signed char)i;
+                p->coluna = (signed char)j;
+                p->orientacao = ORIENTACOES[o];
+                for (int k = 0; k < TAMANHO_NAVIO; k++) {
+                    int celula = INDICE_CELULA(i + k * passoLinha, j + k * passoColuna);
+                    p->celulas[k] = (unsigned char)celula;
+                    posicionamentosPorCelula[celula][quantidadePorCelula[celula]++] =
+                        (short)quantidadePosicionamentos;
+                }
+                indicePosicionamento[i][j][o] = (short)quantidadePosicionamentos;
+                quantidadePosicionamentos++;
+            }
+        }
+    }
+}
+
+/*
+ * Função: inicializarTabelaPosicionamentos
+ * Propósito: Gera uma única vez a tabela de todos os posicionamentos legais
+ *            (288 no tabuleiro 10x10 com navios de 3 posições)
+ * Parâmetros: nenhum
+ * Retorno: void (não retorna valor)
+ * Nota: É chamada automaticamente na primeira consulta e pode ser chamada de
+ *       várias threads ao mesmo tempo.
+ */
+void inicializarTabelaPosicionamentos(void) {
+    pthread_once(&geracaoTabelaPosicionamentos, gerarTabelaPosicionamentos);
+}
+
+/*
+ * Função: consultarPosicionamento
+ * Propósito: Busca na tabela o posicionamento de um navio de TAMANHO_NAVIO posições
+ * Parâmetros:
+ *   - linha, coluna: posição inicial do navio
+ *   - orientacao: 'H', 'V', 'D' ou 'E'
+ * Retorno: ponteiro para a entrada da tabela, ou NULL se o navio não cabe no tabuleiro
+ */
+const Posicionamento *consultarPosicionamento(int linha, int coluna, char orientacao) {
+    int o = indiceOrientacao(orientacao);
+
+    if (o < 0 || linha < 0 || linha >= TAMANHO_TABULEIRO ||
+        coluna < 0 || coluna >= TAMANHO_TABULEIRO) {
+        return NULL;
+    }
+    inicializarTabelaPosicionamentos();
+
+    int indice = indicePosicionamento[linha][coluna][o];
+    return indice < 0 ? NULL : &tabelaPosicionamentos[indice];
+}
+
+/*
+ * Função: buscarPosicionamentoLivre
+ * Propósito: Valida limites e sobreposição de um navio com uma consulta à tabela
+ *            e um único teste de máscara
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits
+ *   - linha, coluna: posição inicial do navio
+ *   - orientacao: 'H', 'V', 'D' ou 'E'
+ * Retorno: entrada da tabela se o navio cabe e está livre, ou NULL caso contrário
+ */
+const Posicionamento *buscarPosicionamentoLivre(const TabuleiroBits *tabuleiro,
+                                                int linha, int coluna, char orientacao) {
+    INSTRUMENTAR_INICIO();
+    const Posicionamento *p = consultarPosicionamento(linha, coluna, orientacao);
+    if (p != NULL && !posicionamentoLivre(tabuleiro, p)) {
+        p = NULL;
+    }
+    INSTRUMENTAR_FIM(PONTO_BUSCAR_POSICIONAMENTO_LIVRE, p == NULL);
+    return p;
+}
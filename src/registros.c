@@ -0,0 +1,366 @@
+/*
+ * Arquivo: src/registros.c
+ * Descrição: Registro binário de partidas e leitor por mapeamento de memória
+ */
+
+#include "batalha_naval_interno.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ========== REGISTRO BINÁRIO DE PARTIDAS ==========
+//
+// Arquivo: ASSINATURA_REGISTROS seguida de partidas, uma após a outra.
+// Partida: varint com o tamanho do corpo, seguido do corpo:
+//   - BYTES_OCUPACAO bytes: camada de navios (bit c % 8 do byte c / 8 = célula c)
+//   - varint n + n varints com as células atingidas, na ordem dos tiros
+//   - varint m + m efeitos: varint tipo, varint raio, zigzag linha, zigzag coluna
+// Varints seguem o formato LEB128 (7 bits por byte, bit 7 indica continuação).
+// Como toda célula é menor que 128, cada tiro ocupa exatamente um byte e a
+// sequência de tiros pode ser lida direto do arquivo mapeado, sem decodificação.
+
+#define TAMANHO_ASSINATURA_REGISTROS 8
+#define MAX_BYTES_VARINT 10                           // Um uint64_t em LEB128
+
+static const unsigned char ASSINATURA_REGISTROS[TAMANHO_ASSINATURA_REGISTROS] =
+    {'B', 'N', 'R', 'E', 'G', 0, 0, 1};
+
+// Escreve um varint LEB128 em destino; retorna a quantidade de bytes
+static int codificarVarint(uint64_t valor, unsigned char *destino) {
+    int n = 0;
+    while (valor >= 0x80) {
+        destino[n++] = (unsigned char)(valor | 0x80);
+        valor >>= 7;
+    }
+    destino[n++] = (unsigned char)valor;
+    return n;
+}
+
+// Lê um varint sem ultrapassar fim; retorna 0 se estiver truncado ou longo demais
+static int decodificarVarint(const unsigned char **cursor, const unsigned char *fim,
+                             uint64_t *valor) {
+    uint64_t resultado = 0;
+    const unsigned char *p = *cursor;
+    for (int deslocamento = 0; p < fim && deslocamento < 7 * MAX_BYTES_VARINT; deslocamento += 7) {
+        unsigned char byte = *p++;
+        resultado |= (uint64_t)(byte & 0x7F) << deslocamento;
+        if (!(byte & 0x80)) {
+            *cursor = p;
+            *valor = resultado;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Zigzag: inteiros pequenos, positivos ou negativos, viram varints curtos
+static uint64_t zigzag(int valor) {
+    return valor >= 0 ? (uint64_t)valor << 1 : (((uint64_t)-(int64_t)valor) << 1) - 1;
+}
+
+static int desfazerZigzag(uint64_t valor) {
+    return (valor & 1) ? -(int)(valor >> 1) - 1 : (int)(valor >> 1);
+}
+
+/*
+ * Função: empacotarOcupacao
+ * Propósito: Grava um bitboard como 100 bits corridos em BYTES_OCUPACAO bytes
+ * Parâmetros:
+ *   - camada: bitboard de origem
+ *   - destino: BYTES_OCUPACAO bytes
+ * Retorno: void (não retorna valor)
+ */
+void empacotarOcupacao(Bitboard camada, unsigned char destino[BYTES_OCUPACAO]) {
+    for (int b = 0; b < BYTES_OCUPACAO; b++) {
+        int bit = b * 8;  // 64 é múltiplo de 8: um byte nunca atravessa as duas palavras
+        destino[b] = (unsigned char)(camada.palavra[bit / 64] >> (bit % 64));
+    }
+}
+
+/*
+ * Função: desempacotarOcupacao
+ * Propósito: Operação inversa de empacotarOcupacao
+ * Parâmetros:
+ *   - origem: BYTES_OCUPACAO bytes
+ * Retorno: bitboard correspondente (bits além da célula 99 são descartados)
+ */
+Bitboard desempacotarOcupacao(const unsigned char origem[BYTES_OCUPACAO]) {
+    Bitboard camada = bitboardVazio();
+    for (int b = 0; b < BYTES_OCUPACAO; b++) {
+        int bit = b * 8;
+        camada.palavra[bit / 64] |= (uint64_t)origem[b] << (bit % 64);
+    }
+    camada.palavra[1] &= ((uint64_t)1 << (CELULAS_TABULEIRO - 64)) - 1;
+    return camada;
+}
+
+/*
+ * Função: abrirEscritorRegistros
+ * Propósito: Cria (ou sobrescreve) um arquivo de registros e grava a assinatura
+ * Parâmetros:
+ *   - escritor: estrutura a ser preenchida
+ *   - caminho: caminho do arquivo
+ * Retorno: 0 em caso de sucesso, -1 se o arquivo não puder ser criado
+ */
+int abrirEscritorRegistros(EscritorRegistros *escritor, const char *caminho) {
+    const size_t tamanhoBuffer = (size_t)1 << 20;
+
+    escritor->arquivo = fopen(caminho, "wb");
+    if (escritor->arquivo == NULL) {
+        return -1;
+    }
+    escritor->buffer = malloc(tamanhoBuffer);
+    if (escritor->buffer != NULL) {
+        setvbuf(escritor->arquivo, escritor->buffer, _IOFBF, tamanhoBuffer);
+    }
+    if (fwrite(ASSINATURA_REGISTROS, 1, TAMANHO_ASSINATURA_REGISTROS, escritor->arquivo) !=
+        TAMANHO_ASSINATURA_REGISTROS) {
+        fclose(escritor->arquivo);
+        free(escritor->buffer);
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Função: gravarPartida
+ * Propósito: Acrescenta uma partida ao arquivo de registros
+ * Parâmetros:
+ *   - escritor: arquivo aberto por abrirEscritorRegistros
+ *   - navios: camada de navios da frota
+ *   - tiros: células atingidas, na ordem
+ *   - quantidadeTiros: tamanho de tiros
+ *   - efeitos: habilidades aplicadas (pode ser NULL se quantidadeEfeitos for 0)
+ *   - quantidadeEfeitos: tamanho de efeitos
+ * Retorno: 0 em caso de sucesso, -1 em erro de escrita ou dados inválidos
+ */
+int gravarPartida(EscritorRegistros *escritor, Bitboard navios, const unsigned char *tiros,
+                  int quantidadeTiros, const EfeitoHabilidade *efeitos, int quantidadeEfeitos) {
+    unsigned char cabecalho[MAX_BYTES_VARINT * 2 + BYTES_OCUPACAO];
+    unsigned char efeito[MAX_BYTES_VARINT * 4];
+    size_t tamanhoCorpo;
+    int n;
+
+    if (quantidadeTiros < 0 || quantidadeTiros > CELULAS_TABULEIRO || quantidadeEfeitos < 0) {
+        return -1;
+    }
+    for (int t = 0; t < quantidadeTiros; t++) {
+        if (tiros[t] >= CELULAS_TABULEIRO) {
+            return -1;  // O leitor depende de um byte por tiro
+        }
+    }
+
+    // O tamanho do corpo vem antes dele: primeiro uma passada só para medir
+    tamanhoCorpo = BYTES_OCUPACAO + (size_t)codificarVarint((uint64_t)quantidadeTiros, cabecalho) +
+                   (size_t)quantidadeTiros +
+                   (size_t)codificarVarint((uint64_t)quantidadeEfeitos, cabecalho);
+    for (int e = 0; e < quantidadeEfeitos; e++) {
+        n = codificarVarint((uint64_t)efeitos[e].forma->tipo, efeito);
+        n += codificarVarint((uint64_t)efeitos[e].forma->raio, efeito + n);
+        n += codificarVarint(zigzag(efeitos[e].linha), efeito + n);
+        n += codificarVarint(zigzag(efeitos[e].coluna), efeito + n);
+        tamanhoCorpo += (size_t)n;
+    }
+
+    n = codificarVarint(tamanhoCorpo, cabecalho);
+    empacotarOcupacao(navios, cabecalho + n);
+    n += BYTES_OCUPACAO;
+    n += codificarVarint((uint64_t)quantidadeTiros, cabecalho + n);
+    if (fwrite(cabecalho, 1, (size_t)n, escritor->arquivo) != (size_t)n ||
+        fwrite(tiros, 1, (size_t)quantidadeTiros, escritor->arquivo) != (size_t)quantidadeTiros) {
+        return -1;
+    }
+
+    n = codificarVarint((uint64_t)quantidadeEfeitos, cabecalho);
+    if (fwrite(cabecalho, 1, (size_t)n, escritor->arquivo) != (size_t)n) {
+        return -1;
+    }
+    for (int e = 0; e < quantidadeEfeitos; e++) {
+        n = codificarVarint((uint64_t)efeitos[e].forma->tipo, efeito);
+        n += codificarVarint((uint64_t)efeitos[e].forma->raio, efeito + n);
+        n += codificarVarint(zigzag(efeitos[e].linha), efeito + n);
+        n += codificarVarint(zigzag(efeitos[e].coluna), efeito + n);
+        if (fwrite(efeito, 1, (size_t)n, escritor->arquivo) != (size_t)n) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Função: fecharEscritorRegistros
+ * Propósito: Descarrega o buffer e fecha o arquivo de registros
+ * Parâmetros:
+ *   - escritor: arquivo aberto por abrirEscritorRegistros
+ * Retorno: 0 em caso de sucesso, -1 se a gravação final falhar
+ */
+int fecharEscritorRegistros(EscritorRegistros *escritor) {
+    int resultado = fclose(escritor->arquivo) == 0 ? 0 : -1;
+    free(escritor->buffer);
+    return resultado;
+}
+
+/*
+ * Função: fecharLeitorRegistros
+ * Propósito: Desfaz o mapeamento e fecha o arquivo
+ * Parâmetros:
+ *   - leitor: arquivo aberto por abrirLeitorRegistros
+ * Retorno: void (não retorna valor)
+ */
+void fecharLeitorRegistros(LeitorRegistros *leitor) {
+#ifdef _WIN32
+    UnmapViewOfFile(leitor->dados);
+    CloseHandle(leitor->mapeamento);
+    CloseHandle(leitor->arquivo);
+#else
+    munmap((void *)(uintptr_t)leitor->dados, leitor->tamanho);
+    close(leitor->descritor);
+#endif
+    leitor->dados = NULL;
+}
+
+/*
+ * Função: abrirLeitorRegistros
+ * Propósito: Mapeia um arquivo de registros inteiro em memória, somente leitura
+ * Parâmetros:
+ *   - leitor: estrutura a ser preenchida
+ *   - caminho: caminho do arquivo
+ * Retorno: 0 em caso de sucesso, -1 se o arquivo não existir, não puder ser
+ *          mapeado ou não começar com a assinatura
+ * Nota: Nada é copiado; o sistema carrega as páginas conforme a leitura avança
+ */
+int abrirLeitorRegistros(LeitorRegistros *leitor, const char *caminho) {
+    leitor->dados = NULL;
+    leitor->tamanho = 0;
+    leitor->posicao = TAMANHO_ASSINATURA_REGISTROS;
+
+#ifdef _WIN32
+    LARGE_INTEGER tamanho;
+    leitor->mapeamento = NULL;
+    leitor->arquivo = CreateFileA(caminho, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                  FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (leitor->arquivo == INVALID_HANDLE_VALUE) {
+        return -1;
+    }
+    if (!GetFileSizeEx(leitor->arquivo, &tamanho) ||
+        tamanho.QuadPart < TAMANHO_ASSINATURA_REGISTROS) {
+        CloseHandle(leitor->arquivo);
+        return -1;
+    }
+    leitor->tamanho = (size_t)tamanho.QuadPart;
+    leitor->mapeamento = CreateFileMappingA(leitor->arquivo, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (leitor->mapeamento != NULL) {
+        leitor->dados = MapViewOfFile(leitor->mapeamento, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (leitor->dados == NULL) {
+        if (leitor->mapeamento != NULL) CloseHandle(leitor->mapeamento);
+        CloseHandle(leitor->arquivo);
+        return -1;
+    }
+#else
+    struct stat informacoes;
+    leitor->descritor = open(caminho, O_RDONLY);
+    if (leitor->descritor < 0) {
+        return -1;
+    }
+    if (fstat(leitor->descritor, &informacoes) != 0 ||
+        informacoes.st_size < TAMANHO_ASSINATURA_REGISTROS) {
+        close(leitor->descritor);
+        return -1;
+    }
+    leitor->tamanho = (size_t)informacoes.st_size;
+    void *mapa = mmap(NULL, leitor->tamanho, PROT_READ, MAP_PRIVATE, leitor->descritor, 0);
+    if (mapa == MAP_FAILED) {
+        close(leitor->descritor);
+        return -1;
+    }
+    madvise(mapa, leitor->tamanho, MADV_SEQUENTIAL);  // Leitura antecipada agressiva
+    leitor->dados = mapa;
+#endif
+
+    if (memcmp(leitor->dados, ASSINATURA_REGISTROS, TAMANHO_ASSINATURA_REGISTROS) != 0) {
+        fecharLeitorRegistros(leitor);
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Função: proximaPartida
+ * Propósito: Avança para a próxima partida do arquivo mapeado
+ * Parâmetros:
+ *   - leitor: arquivo aberto por abrirLeitorRegistros
+ *   - partida: recebe ponteiros para os campos da partida, dentro do mapeamento
+ * Retorno: 1 se uma partida foi lida, 0 no fim do arquivo, -1 se o arquivo
+ *          estiver truncado ou corrompido
+ * Nota: Os tiros são verificados (todos menores que CELULAS_TABULEIRO); os
+ *       efeitos só são decodificados por lerEfeitoRegistrado, quando pedidos
+ */
+int proximaPartida(LeitorRegistros *leitor, RegistroPartida *partida) {
+    const unsigned char *cursor = leitor->dados + leitor->posicao;
+    const unsigned char *fimArquivo = leitor->dados + leitor->tamanho;
+    const unsigned char *fim;
+    uint64_t tamanhoCorpo, tiros, efeitos;
+
+    if (cursor == fimArquivo) {
+        return 0;
+    }
+    if (!decodificarVarint(&cursor, fimArquivo, &tamanhoCorpo) ||
+        tamanhoCorpo > (uint64_t)(fimArquivo - cursor) || tamanhoCorpo < BYTES_OCUPACAO) {
+        return -1;
+    }
+    fim = cursor + tamanhoCorpo;
+
+    partida->ocupacao = cursor;
+    cursor += BYTES_OCUPACAO;
+    if (!decodificarVarint(&cursor, fim, &tiros) || tiros > CELULAS_TABULEIRO ||
+        tiros > (uint64_t)(fim - cursor)) {
+        return -1;
+    }
+    partida->tiros = cursor;
+    partida->quantidadeTiros = (int)tiros;
+    for (int t = 0; t < partida->quantidadeTiros; t++) {
+        if (cursor[t] >= CELULAS_TABULEIRO) {
+            return -1;
+        }
+    }
+    cursor += tiros;
+    // Cada efeito tem quatro campos de pelo menos um byte
+    if (!decodificarVarint(&cursor, fim, &efeitos) || efeitos > (uint64_t)(fim - cursor) / 4) {
+        return -1;
+    }
+    partida->efeitos = cursor;
+    partida->quantidadeEfeitos = (int)efeitos;
+    partida->fim = fim;
+
+    leitor->posicao = (size_t)(fim - leitor->dados);
+    return 1;
+}
+
+/*
+ * Função: lerEfeitoRegistrado
+ * Propósito: Decodifica o próximo efeito de uma partida
+ * Parâmetros:
+ *   - cursor: posição atual (começa em partida->efeitos e é avançada)
+ *   - fim: limite de leitura (partida->fim)
+ *   - efeito: recebe a forma e a origem
+ * Retorno: 1 em caso de sucesso, 0 se o efeito estiver truncado ou a forma não existir
+ */
+int lerEfeitoRegistrado(const unsigned char **cursor, const unsigned char *fim,
+                        EfeitoHabilidade *efeito) {
+    uint64_t tipo, raio, linha, coluna;
+    if (!decodificarVarint(cursor, fim, &tipo) || !decodificarVarint(cursor, fim, &raio) ||
+        !decodificarVarint(cursor, fim, &linha) || !decodificarVarint(cursor, fim, &coluna) ||
+        tipo >= QUANTIDADE_FORMAS || raio > RAIO_MAXIMO_FORMA ||
+        linha > UINT32_MAX || coluna > UINT32_MAX) {
+        return 0;
+    }
+    efeito->forma = obterForma((TipoForma)tipo, (int)raio);
+    efeito->linha = desfazerZigzag(linha);
+    efeito->coluna = desfazerZigzag(coluna);
+    return 1;
+}
@@ -0,0 +1,160 @@
+/*
+ * Arquivo: src/saida.c
+ * Descrição: Exibição de tabuleiros em buffer e modos de saída
+ */
+
+#include "batalha_naval_interno.h"
+
+#include <stdarg.h>
+
+// ========== SAÍDA EM BUFFER ==========
+
+#define CELULAS_POR_DIGITO_HEXA 4     // Células codificadas por dígito hexadecimal no modo fluxo
+#define DIGITOS_CAMADA ((CELULAS_TABULEIRO + CELULAS_POR_DIGITO_HEXA - 1) / CELULAS_POR_DIGITO_HEXA)
+
+static ModoSaida modoSaida = SAIDA_NORMAL;
+
+// Trechos fixos do tabuleiro formatado (TAMANHO_TABULEIRO de um dígito)
+static const char CABECALHO_TABULEIRO[] =
+    "\n=== TABULEIRO DE BATALHA NAVAL ===\n\n    0 1 2 3 4 5 6 7 8 9\n";
+static const char LEGENDA_TABULEIRO[] =
+    "\nLegenda: 0 = Agua, 3 = Navio, 5 = Area de Habilidade\n";
+
+// Texto de cada valor de célula (espaço + dígito), indexado pelo próprio valor
+static const char GLIFOS_CELULA[10][2] = {
+    {' ', '0'}, {' ', '1'}, {' ', '2'}, {' ', '3'}, {' ', '4'},
+    {' ', '5'}, {' ', '6'}, {' ', '7'}, {' ', '8'}, {' ', '9'}
+};
+static const char DIGITOS_HEXA[] = "0123456789abcdef";
+
+/*
+ * Função: definirModoSaida
+ * Propósito: Escolhe o modo de saída e ativa o buffer completo da saída padrão
+ * Parâmetros:
+ *   - modo: novo modo de saída
+ * Retorno: void (não retorna valor)
+ * Nota: Deve ser chamada antes de qualquer escrita em stdout
+ */
+void definirModoSaida(ModoSaida modo) {
+    static char bufferSaida[1 << 16];
+    modoSaida = modo;
+    setvbuf(stdout, bufferSaida, _IOFBF, sizeof(bufferSaida));
+}
+
+/*
+ * Função: mensagem
+ * Propósito: printf para mensagens de progresso, suprimido fora do modo normal
+ * Parâmetros:
+ *   - formato, ...: mesmos argumentos de printf
+ * Retorno: void (não retorna valor)
+ */
+#ifdef __GNUC__
+__attribute__((format(printf, 1, 2)))
+#endif
+void mensagem(const char *formato, ...) {
+    if (modoSaida != SAIDA_NORMAL) {
+        return;
+    }
+    va_list argumentos;
+    va_start(argumentos, formato);
+    vprintf(formato, argumentos);
+    va_end(argumentos);
+}
+
+/*
+ * Função: formatarTabuleiroBits
+ * Propósito: Escreve o tabuleiro inteiro, no formato de exibirTabuleiro, em um buffer
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits
+ *   - buffer: destino com pelo menos TAMANHO_BUFFER_TABULEIRO bytes
+ * Retorno: quantidade de bytes escritos (sem terminador nulo)
+ * Lógica: Só cópias de trechos prontos e de glifos da tabela; nenhuma formatação numérica
+ */
+size_t formatarTabuleiroBits(const TabuleiroBits *tabuleiro, char *buffer) {
+    char *escrita = buffer;
+
+    memcpy(escrita, CABECALHO_TABULEIRO, sizeof(CABECALHO_TABULEIRO) - 1);
+    escrita += sizeof(CABECALHO_TABULEIRO) - 1;
+
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        *escrita++ = DIGITOS_HEXA[i];  // Número da linha
+        *escrita++ = ' ';
+        *escrita++ = ' ';
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            int indice = INDICE_CELULA(i, j);
+            int valor = bitboardContemCelula(tabuleiro->navios, indice)     ? NAVIO
+                      : bitboardContemCelula(tabuleiro->habilidade, indice) ? HABILIDADE
+                                                                            : AGUA;
+            memcpy(escrita, GLIFOS_CELULA[valor], 2);
+            escrita += 2;
+        }
+        *escrita++ = '\n';
+    }
+
+    memcpy(escrita, LEGENDA_TABULEIRO, sizeof(LEGENDA_TABULEIRO) - 1);
+    escrita += sizeof(LEGENDA_TABULEIRO) - 1;
+    return (size_t)(escrita - buffer);
+}
+
+/*
+ * Função: codificarTabuleiroBits
+ * Propósito: Codifica o tabuleiro em uma única linha de texto para o modo fluxo
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits
+ *   - buffer: destino com pelo menos TAMANHO_BUFFER_TABULEIRO bytes
+ * Retorno: quantidade de bytes escritos (sem terminador nulo)
+ * Formato: "n=<navios> h=<habilidade> t=<tiros>\n", cada camada com 25 dígitos
+ *          hexadecimais; o dígito k guarda as células 4k a 4k+3 (bit 0 = célula 4k)
+ */
+size_t codificarTabuleiroBits(const TabuleiroBits *tabuleiro, char *buffer) {
+    const Bitboard *camadas[3] = {&tabuleiro->navios, &tabuleiro->habilidade, &tabuleiro->tiros};
+    const char prefixos[3] = {'n', 'h', 't'};
+    char *escrita = buffer;
+
+    for (int k = 0; k < 3; k++) {
+        *escrita++ = prefixos[k];
+        *escrita++ = '=';
+        for (int d = 0; d < DIGITOS_CAMADA; d++) {
+            int bit = d * CELULAS_POR_DIGITO_HEXA;
+            // 64 é múltiplo de 4: um dígito nunca atravessa as duas palavras
+            uint64_t nibble = camadas[k]->palavra[bit / 64] >> (bit % 64);
+            *escrita++ = DIGITOS_HEXA[nibble & 0xF];
+        }
+        *escrita++ = k < 2 ? ' ' : '\n';
+    }
+    return (size_t)(escrita - buffer);
+}
+
+/*
+ * Função: exibirTabuleiroBits
+ * Propósito: Exibe um tabuleiro em bits de acordo com o modo de saída,
+ *            com uma única escrita na saída padrão
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits a ser exibido
+ * Retorno: void (não retorna valor)
+ */
+void exibirTabuleiroBits(const TabuleiroBits *tabuleiro) {
+    char buffer[TAMANHO_BUFFER_TABULEIRO];
+    size_t tamanho;
+
+    if (modoSaida == SAIDA_SILENCIOSA) {
+        return;
+    }
+    tamanho = modoSaida == SAIDA_FLUXO ? codificarTabuleiroBits(tabuleiro, buffer)
+                                       : formatarTabuleiroBits(tabuleiro, buffer);
+    fwrite(buffer, 1, tamanho, stdout);
+}
+
+/*
+ * Função: exibirTabuleiro
+ * Propósito: Exibe o tabuleiro no console de forma organizada e legível
+ * Parâmetros:
+ *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
+ * Retorno: void (não retorna valor)
+ * Nota: Valores fora de AGUA/NAVIO/HABILIDADE são descartados pela compactação em bits
+ */
+void exibirTabuleiro(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]) {
+    TabuleiroBits bits;
+    compactarTabuleiro(tabuleiro, &bits);
+    exibirTabuleiroBits(&bits);
+}
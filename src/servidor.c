@@ -0,0 +1,421 @@
+/*
+ * Arquivo: src/servidor.c
+ * Descrição: Servidor de partidas: muitas partidas independentes, fragmentadas e
+ *            processadas em lotes pelo pool de trabalho
+ */
+
+#include "batalha_naval_interno.h"
+
+#include <stdatomic.h>
+
+// ========== SERVIDOR DE PARTIDAS ==========
+
+#define CAPACIDADE_INICIAL_FRAGMENTO 64  // Partidas por fragmento antes do primeiro crescimento
+
+/*
+ * Tipo: Partida
+ * Propósito: Estado de uma partida hospedada no servidor
+ * Campos:
+ *   - trava: protege a fila de jogadas, agendada e o estado do jogo; é exclusiva
+ *            da partida, então partidas diferentes nunca disputam a mesma trava
+ *   - fila, inicio, quantidade: jogadas recebidas e ainda não resolvidas (circular)
+ *   - agendada: 1 enquanto houver uma tarefa do pool responsável pela partida
+ *   - id, contexto: identificação devolvida ao cliente em cada resposta
+ *   - fase, tiros, tabuleiro, navios: estado do jogo
+ *   - visao: o tabuleiro como o cliente atacante o enxerga; aponta para as camadas
+ *            de tabuleiro, e só a prévia (internada no servidor) é guardada à parte
+ *   - servidor: servidor que hospeda a partida
+ */
+typedef struct {
+    _Alignas(ALINHAMENTO_CACHE) pthread_mutex_t trava;
+    Jogada fila[CAPACIDADE_FILA_JOGADAS];
+    int inicio;
+    int quantidade;
+    int agendada;
+    uint64_t id;
+    void *contexto;
+    FasePartida fase;
+    int tiros;
+    TabuleiroBits tabuleiro;
+    TabelaNavios navios;
+    VisaoAtacante visao;
+    ServidorPartidas *servidor;
+} Partida;
+
+/*
+ * Tipo: FragmentoServidor
+ * Propósito: Uma fatia das partidas, com trava própria. O identificador da partida
+ *            carrega o número do fragmento nos BITS_FRAGMENTO bits baixos, então
+ *            cada consulta toca só um fragmento e nenhuma trava global existe.
+ * Campos:
+ *   - trava: protege o vetor de partidas
+ *   - partidas: ponteiros para as partidas (o índice vem do identificador)
+ *   - quantidade, capacidade: ocupação do vetor
+ */
+typedef struct {
+    _Alignas(ALINHAMENTO_CACHE) pthread_mutex_t trava;
+    Partida **partidas;
+    uint32_t quantidade;
+    uint32_t capacidade;
+} FragmentoServidor;
+
+/*
+ * Tipo: ServidorPartidas
+ * Campos:
+ *   - pool: threads que resolvem as jogadas
+ *   - fragmentos: partidas divididas por fragmento
+ *   - proximoFragmento: rodízio dos fragmentos na criação de partidas
+ *   - camadas: prévias de habilidade internadas, compartilhadas por todas as partidas
+ *   - aoResolver: resposta de cada jogada (pode ser NULL)
+ */
+struct ServidorPartidas {
+    PoolTrabalho *pool;
+    FragmentoServidor fragmentos[QUANTIDADE_FRAGMENTOS];
+    atomic_uint proximoFragmento;
+    RegistroCamadas *camadas;
+    RespostaJogada aoResolver;
+};
+
+/*
+ * Função: criarServidorPartidas
+ * Propósito: Cria o servidor e o seu pool de trabalho
+ * Parâmetros:
+ *   - configuracao: threads e função de resposta
+ * Retorno: servidor pronto, ou NULL se faltar memória ou não for possível criar as threads
+ */
+ServidorPartidas *criarServidorPartidas(const ConfiguracaoServidor *configuracao) {
+    ServidorPartidas *servidor = alocarAlinhado(sizeof(ServidorPartidas));
+    if (servidor == NULL) {
+        return NULL;
+    }
+
+    // As tabelas globais são preenchidas antes de qualquer thread começar
+    inicializarTabelaPosicionamentos();
+
+    servidor->camadas = criarRegistroCamadas();
+    if (servidor->camadas == NULL) {
+        liberarAlinhado(servidor);
+        return NULL;
+    }
+    servidor->pool = criarPoolTrabalho(configuracao->threads);
+    if (servidor->pool == NULL) {
+        destruirRegistroCamadas(servidor->camadas);
+        liberarAlinhado(servidor);
+        return NULL;
+    }
+    for (int f = 0; f < QUANTIDADE_FRAGMENTOS; f++) {
+        pthread_mutex_init(&servidor->fragmentos[f].trava, NULL);
+        servidor->fragmentos[f].partidas = NULL;
+        servidor->fragmentos[f].quantidade = 0;
+        servidor->fragmentos[f].capacidade = 0;
+    }
+    atomic_init(&servidor->proximoFragmento, 0);
+    servidor->aoResolver = configuracao->aoResolver;
+    return servidor;
+}
+
+/*
+ * Função: criarPartida
+ * Propósito: Abre uma nova partida, na fase de preparação e com o tabuleiro vazio
+ * Parâmetros:
+ *   - servidor: servidor de partidas
+ *   - contexto: ponteiro do cliente, repassado a cada resposta da partida
+ *   - partida: recebe o identificador da nova partida
+ * Retorno: 0 em caso de sucesso, -1 se faltar memória
+ */
+int criarPartida(ServidorPartidas *servidor, void *contexto, uint64_t *partida) {
+    unsigned f = atomic_fetch_add(&servidor->proximoFragmento, 1) % QUANTIDADE_FRAGMENTOS;
+    FragmentoServidor *fragmento = &servidor->fragmentos[f];
+    Partida *nova = alocarAlinhado(sizeof(Partida));
+
+    if (nova == NULL) {
+        return -1;
+    }
+    pthread_mutex_init(&nova->trava, NULL);
+    nova->inicio = 0;
+    nova->quantidade = 0;
+    nova->agendada = 0;
+    nova->contexto = contexto;
+    nova->fase = PARTIDA_PREPARACAO;
+    nova->tiros = 0;
+    inicializarTabuleiroBits(&nova->tabuleiro);
+    iniciarTabelaNavios(&nova->navios);
+    iniciarVisaoAtacante(&nova->visao, &nova->tabuleiro.navios, &nova->tabuleiro.tiros);
+    nova->servidor = servidor;
+
+    pthread_mutex_lock(&fragmento->trava);
+    if (fragmento->quantidade == fragmento->capacidade) {
+        uint32_t capacidade = fragmento->capacidade ? fragmento->capacidade * 2
+                                                    : CAPACIDADE_INICIAL_FRAGMENTO;
+        Partida **partidas = realloc(fragmento->partidas, capacidade * sizeof(Partida *));
+        if (partidas == NULL) {
+            pthread_mutex_unlock(&fragmento->trava);
+            pthread_mutex_destroy(&nova->trava);
+            liberarAlinhado(nova);
+            return -1;
+        }
+        fragmento->partidas = partidas;
+        fragmento->capacidade = capacidade;
+    }
+    nova->id = ((uint64_t)fragmento->quantidade << BITS_FRAGMENTO) | f;
+    fragmento->partidas[fragmento->quantidade++] = nova;
+    pthread_mutex_unlock(&fragmento->trava);
+
+    *partida = nova->id;
+    return 0;
+}
+
+// Localiza a partida pelo identificador (trava apenas o fragmento dela); NULL se não existe
+static Partida *buscarPartida(ServidorPartidas *servidor, uint64_t id) {
+    FragmentoServidor *fragmento = &servidor->fragmentos[id & (QUANTIDADE_FRAGMENTOS - 1)];
+    uint64_t indice = id >> BITS_FRAGMENTO;
+    Partida *partida = NULL;
+
+    pthread_mutex_lock(&fragmento->trava);
+    if (indice < fragmento->quantidade) {
+        partida = fragmento->partidas[indice];
+    }
+    pthread_mutex_unlock(&fragmento->trava);
+    return partida;
+}
+
+// Aplica uma jogada às regras do jogo (com a trava da partida já obtida)
+static int aplicarJogada(Partida *partida, const Jogada *jogada) {
+    if (partida->fase == PARTIDA_ENCERRADA) {
+        return JOGADA_FORA_DE_FASE;
+    }
+
+    switch (jogada->tipo) {
+        case JOGADA_POSICIONAR: {
+            const Posicionamento *p;
+            if (partida->fase != PARTIDA_PREPARACAO) {
+                return JOGADA_FORA_DE_FASE;
+            }
+            p = consultarPosicionamento(jogada->linha, jogada->coluna, jogada->orientacao);
+            if (p == NULL) {
+                return JOGADA_POSICAO_INVALIDA;
+            }
+            if (!posicionamentoLivre(&partida->tabuleiro, p)) {
+                return JOGADA_SOBREPOSICAO;
+            }
+            posicionarNavioBits(&partida->tabuleiro, p->linha, p->coluna, p->orientacao);
+            adicionarNavioRastreado(&partida->navios, p);
+            return JOGADA_ACEITA;
+        }
+        case JOGADA_HABILIDADE: {
+            const FormaHabilidade *forma;
+            if (partida->fase != PARTIDA_PREPARACAO) {
+                return JOGADA_FORA_DE_FASE;
+            }
+            forma = obterForma((TipoForma)jogada->forma, jogada->raio);
+            if (forma == NULL) {
+                return JOGADA_INVALIDA;
+            }
+            aplicarFormaBits(&partida->tabuleiro, forma, jogada->linha, jogada->coluna);
+            return JOGADA_ACEITA;
+        }
+        case JOGADA_PREVIA: {
+            const FormaHabilidade *forma = obterForma((TipoForma)jogada->forma, jogada->raio);
+            if (forma == NULL) {
+                return JOGADA_INVALIDA;
+            }
+            if (previsualizarFormaVisao(&partida->visao, partida->servidor->camadas, forma,
+                                        jogada->linha, jogada->coluna) != 0) {
+                return JOGADA_INVALIDA;
+            }
+            return JOGADA_ACEITA;
+        }
+        case JOGADA_SORTEAR_FROTA: {
+            GeradorAleatorio gerador;
+            Frota frota;
+            if (partida->fase != PARTIDA_PREPARACAO) {
+                return JOGADA_FORA_DE_FASE;
+            }
+            semearGerador(&gerador, jogada->semente);
+            gerarFrota(&gerador, FROTA_UNIFORME, &frota);
+            inicializarTabuleiroBits(&partida->tabuleiro);
+            posicionarFrotaBits(&partida->tabuleiro, &frota);
+            rastrearFrota(&partida->navios, &frota);
+            return JOGADA_ACEITA;
+        }
+        case JOGADA_TIRO: {
+            ResultadoTiro resultado;
+            if (jogada->linha < 0 || jogada->linha >= TAMANHO_TABULEIRO ||
+                jogada->coluna < 0 || jogada->coluna >= TAMANHO_TABULEIRO) {
+                return JOGADA_INVALIDA;
+            }
+            if (partida->navios.naviosRestantes == 0) {
+                return JOGADA_FORA_DE_FASE;  // Ainda não há frota para atacar
+            }
+            partida->fase = PARTIDA_EM_ANDAMENTO;
+            resultado = resolverTiro(&partida->navios, &partida->tabuleiro,
+                                     INDICE_CELULA(jogada->linha, jogada->coluna), NULL);
+            if (resultado != TIRO_REPETIDO) {
+                partida->tiros++;
+            }
+            if (resultado == TIRO_FIM_DE_JOGO) {
+                partida->fase = PARTIDA_ENCERRADA;
+            }
+            return (int)resultado;
+        }
+        default:
+            return JOGADA_INVALIDA;
+    }
+}
+
+/*
+ * Função: processarPartida
+ * Propósito: Tarefa do pool: resolve de uma vez todas as jogadas pendentes de uma
+ *            partida e entrega as respostas
+ * Parâmetros:
+ *   - argumento: a Partida
+ * Retorno: void (não retorna valor)
+ * Lógica: O lote inteiro é resolvido com uma única aquisição da trava da partida.
+ *         As respostas saem depois de liberar a trava, para que o cliente possa
+ *         enviar novas jogadas de dentro delas. Se chegaram jogadas nesse meio
+ *         tempo, a partida volta para o pool em vez de monopolizar a thread.
+ */
+static void processarPartida(void *argumento) {
+    Partida *partida = argumento;
+    ServidorPartidas *servidor = partida->servidor;
+    Jogada lote[CAPACIDADE_FILA_JOGADAS];
+    int resultados[CAPACIDADE_FILA_JOGADAS];
+    int quantidade;
+
+    pthread_mutex_lock(&partida->trava);
+    quantidade = partida->quantidade;
+    for (int i = 0; i < quantidade; i++) {
+        lote[i] = partida->fila[(partida->inicio + i) % CAPACIDADE_FILA_JOGADAS];
+        resultados[i] = aplicarJogada(partida, &lote[i]);
+    }
+    partida->inicio = (partida->inicio + quantidade) % CAPACIDADE_FILA_JOGADAS;
+    partida->quantidade = 0;
+    pthread_mutex_unlock(&partida->trava);
+
+    if (servidor->aoResolver != NULL) {
+        for (int i = 0; i < quantidade; i++) {
+            servidor->aoResolver(partida->contexto, partida->id, &lote[i], resultados[i]);
+        }
+    }
+
+    pthread_mutex_lock(&partida->trava);
+    int reagendar = partida->quantidade > 0;
+    partida->agendada = reagendar;
+    pthread_mutex_unlock(&partida->trava);
+    if (reagendar && enviarTarefa(servidor->pool, processarPartida, partida) != 0) {
+        pthread_mutex_lock(&partida->trava);
+        partida->agendada = 0;  // O próximo enviarJogadas tenta agendar de novo
+        pthread_mutex_unlock(&partida->trava);
+    }
+}
+
+/*
+ * Função: enviarJogadas
+ * Propósito: Entrega um lote de jogadas a uma partida; as respostas chegam depois,
+ *            por aoResolver, na ordem em que as jogadas foram enviadas
+ * Parâmetros:
+ *   - servidor: servidor de partidas
+ *   - partida: identificador devolvido por criarPartida
+ *   - jogadas: lote de jogadas
+ *   - quantidade: tamanho do lote (até CAPACIDADE_FILA_JOGADAS)
+ * Retorno: 0 se o lote foi aceito, -1 se a partida não existe, se a fila da partida
+ *          não comporta o lote inteiro (nada é enfileirado) ou se faltar memória
+ */
+int enviarJogadas(ServidorPartidas *servidor, uint64_t partida, const Jogada *jogadas,
+                  int quantidade) {
+    Partida *alvo = buscarPartida(servidor, partida);
+    int agendar;
+
+    if (alvo == NULL || quantidade < 0) {
+        return -1;
+    }
+    pthread_mutex_lock(&alvo->trava);
+    if (alvo->quantidade + quantidade > CAPACIDADE_FILA_JOGADAS) {
+        pthread_mutex_unlock(&alvo->trava);
+        return -1;
+    }
+    for (int i = 0; i < quantidade; i++) {
+        alvo->fila[(alvo->inicio + alvo->quantidade + i) % CAPACIDADE_FILA_JOGADAS] = jogadas[i];
+    }
+    alvo->quantidade += quantidade;
+    agendar = !alvo->agendada && alvo->quantidade > 0;
+    if (agendar) {
+        alvo->agendada = 1;
+    }
+    pthread_mutex_unlock(&alvo->trava);
+
+    if (agendar && enviarTarefa(servidor->pool, processarPartida, alvo) != 0) {
+        pthread_mutex_lock(&alvo->trava);
+        alvo->agendada = 0;
+        pthread_mutex_unlock(&alvo->trava);
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Função: consultarPartida
+ * Propósito: Copia o estado atual de uma partida
+ * Parâmetros:
+ *   - servidor: servidor de partidas
+ *   - partida: identificador da partida
+ *   - estado: recebe a cópia
+ * Retorno: 0 em caso de sucesso, -1 se a partida não existe
+ */
+int consultarPartida(ServidorPartidas *servidor, uint64_t partida, EstadoPartida *estado) {
+    Partida *alvo = buscarPartida(servidor, partida);
+    if (alvo == NULL) {
+        return -1;
+    }
+    pthread_mutex_lock(&alvo->trava);
+    estado->fase = alvo->fase;
+    estado->tiros = alvo->tiros;
+    estado->naviosRestantes = alvo->navios.naviosRestantes;
+    estado->tabuleiro = alvo->tabuleiro;
+    estado->previa = alvo->visao.previa != NULL ? alvo->visao.previa->celulas : bitboardVazio();
+    pthread_mutex_unlock(&alvo->trava);
+    return 0;
+}
+
+/*
+ * Função: aguardarServidor
+ * Propósito: Bloqueia até que todas as jogadas enviadas, inclusive as enviadas
+ *            pelas próprias respostas, tenham sido resolvidas
+ * Parâmetros:
+ *   - servidor: servidor de partidas
+ * Retorno: void (não retorna valor)
+ */
+void aguardarServidor(ServidorPartidas *servidor) {
+    aguardarPoolTrabalho(servidor->pool);
+}
+
+// Pool de trabalho do servidor (para consultar threads e roubos)
+const PoolTrabalho *poolServidor(const ServidorPartidas *servidor) {
+    return servidor->pool;
+}
+
+/*
+ * Função: destruirServidorPartidas
+ * Propósito: Resolve as jogadas pendentes, encerra as threads e libera todas as partidas
+ * Parâmetros:
+ *   - servidor: servidor criado por criarServidorPartidas (aceita NULL)
+ * Retorno: void (não retorna valor)
+ */
+void destruirServidorPartidas(ServidorPartidas *servidor) {
+    if (servidor == NULL) {
+        return;
+    }
+    destruirPoolTrabalho(servidor->pool);
+    for (int f = 0; f < QUANTIDADE_FRAGMENTOS; f++) {
+        FragmentoServidor *fragmento = &servidor->fragmentos[f];
+        for (uint32_t i = 0; i < fragmento->quantidade; i++) {
+            limparPreviaVisao(&fragmento->partidas[i]->visao, servidor->camadas);
+            pthread_mutex_destroy(&fragmento->partidas[i]->trava);
+            liberarAlinhado(fragmento->partidas[i]);
+        }
+        free(fragmento->partidas);
+        pthread_mutex_destroy(&fragmento->trava);
+    }
+    destruirRegistroCamadas(servidor->camadas);
+    liberarAlinhado(servidor);
+}
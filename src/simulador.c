@@ -0,0 +1,186 @@
+/*
+ * Arquivo: src/simulador.c
+ * Descrição: Simulador de Monte Carlo em várias threads
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== SIMULADOR DE MONTE CARLO EM VÁRIAS THREADS ==========
+
+#define MAX_THREADS_SIMULACAO 256  // Limite de threads de trabalho do simulador
+
+/*
+ * Tipo: TrabalhoSimulacao
+ * Propósito: Tudo o que uma thread de trabalho usa. Nada é compartilhado entre
+ *            threads; o alinhamento evita falso compartilhamento de cache.
+ */
+typedef struct {
+    _Alignas(ALINHAMENTO_CACHE) long long partidas;
+    uint64_t semente;
+    PoliticaTiro politica;
+    ModoGeracaoFrota modoFrota;
+    long long histograma[CELULAS_TABULEIRO + 1];
+} TrabalhoSimulacao;
+
+/*
+ * Função: jogarPartidaRegistrada
+ * Propósito: Joga uma partida completa e devolve o tabuleiro final e a ordem dos tiros
+ * Parâmetros:
+ *   - gerador: gerador da thread (define frota e, na política aleatória, os tiros)
+ *   - politica: estratégia de tiro
+ *   - modoFrota: modo de sorteio da frota
+ *   - tabuleiro: recebe o tabuleiro final (frota e camada de tiros)
+ *   - sequencia: recebe as células atingidas, na ordem; pode ser NULL
+ * Retorno: quantidade de tiros necessária para afundar todos os navios
+ */
+int jogarPartidaRegistrada(GeradorAleatorio *gerador, PoliticaTiro politica,
+                           ModoGeracaoFrota modoFrota, TabuleiroBits *tabuleiro,
+                           unsigned char sequencia[CELULAS_TABULEIRO]) {
+    Frota frota;
+    TabelaNavios navios;
+    int tiros = 0;
+
+    inicializarTabuleiroBits(tabuleiro);
+    gerarFrota(gerador, modoFrota, &frota);
+    posicionarFrotaBits(tabuleiro, &frota);
+    rastrearFrota(&navios, &frota);
+
+    // A partida acaba quando o último navio afunda (contador da tabela de navios)
+    if (politica == POLITICA_CACA) {
+        EstadoCaca caca;
+        iniciarCaca(&caca);
+        while (navios.naviosRestantes > 0) {
+            int alvo = escolherAlvo(&caca);
+            ResultadoTiro resultado = resolverTiro(&navios, tabuleiro, alvo, NULL);
+            registrarTiroCaca(&caca, alvo, resultado != TIRO_AGUA);
+            if (sequencia != NULL) {
+                sequencia[tiros] = (unsigned char)alvo;
+            }
+            tiros++;
+        }
+    } else {
+        // Embaralhamento de Fisher-Yates sorteado a cada tiro: nenhuma célula se repete
+        unsigned char ordem[CELULAS_TABULEIRO];
+        for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+            ordem[c] = (unsigned char)c;
+        }
+        while (navios.naviosRestantes > 0) {
+            int j = tiros + (int)aleatorioAte(gerador, (uint32_t)(CELULAS_TABULEIRO - tiros));
+            unsigned char alvo = ordem[j];
+            ordem[j] = ordem[tiros];
+            ordem[tiros] = alvo;
+            resolverTiro(&navios, tabuleiro, alvo, NULL);
+            tiros++;
+        }
+        if (sequencia != NULL) {
+            memcpy(sequencia, ordem, (size_t)tiros);
+        }
+    }
+    return tiros;
+}
+
+/*
+ * Função: jogarPartida
+ * Propósito: Joga uma partida completa: sorteia a frota e atira até afundá-la
+ * Parâmetros:
+ *   - gerador: gerador da thread (define frota e, na política aleatória, os tiros)
+ *   - politica: estratégia de tiro
+ *   - modoFrota: modo de sorteio da frota
+ * Retorno: quantidade de tiros necessária para afundar todos os navios
+ */
+int jogarPartida(GeradorAleatorio *gerador, PoliticaTiro politica, ModoGeracaoFrota modoFrota) {
+    TabuleiroBits tabuleiro;
+    return jogarPartidaRegistrada(gerador, politica, modoFrota, &tabuleiro, NULL);
+}
+
+// Corpo de cada thread de trabalho: joga a sua cota de partidas
+static void *executarTrabalhoSimulacao(void *argumento) {
+    TrabalhoSimulacao *trabalho = argumento;
+    GeradorAleatorio gerador;
+
+    semearGerador(&gerador, trabalho->semente);
+    for (long long i = 0; i < trabalho->partidas; i++) {
+        trabalho->histograma[jogarPartida(&gerador, trabalho->politica, trabalho->modoFrota)]++;
+    }
+    return NULL;
+}
+
+/*
+ * Função: simularPartidas
+ * Propósito: Joga muitas partidas em paralelo e reúne a distribuição de tiros
+ * Parâmetros:
+ *   - configuracao: quantidade de partidas, threads, semente e estratégias
+ *   - resultado: recebe o histograma e as medidas de vazão
+ * Retorno: 0 em caso de sucesso, -1 se não for possível criar as threads
+ * Nota: Com a mesma semente e a mesma quantidade de threads, o resultado é
+ *       sempre o mesmo.
+ */
+int simularPartidas(const ConfiguracaoSimulacao *configuracao, ResultadoSimulacao *resultado) {
+    int quantidadeThreads = configuracao->threads > 0 ? configuracao->threads : contarNucleos();
+    if (quantidadeThreads > MAX_THREADS_SIMULACAO) {
+        quantidadeThreads = MAX_THREADS_SIMULACAO;
+    }
+
+    TrabalhoSimulacao *trabalhos = alocarAlinhado(sizeof(TrabalhoSimulacao) *
+                                                  (size_t)quantidadeThreads);
+    pthread_t threads[MAX_THREADS_SIMULACAO];
+    if (trabalhos == NULL) {
+        return -1;
+    }
+
+    // As tabelas globais são preenchidas antes de qualquer thread começar
+    inicializarTabelaPosicionamentos();
+
+    uint64_t sementeBase = configuracao->semente;
+    for (int t = 0; t < quantidadeThreads; t++) {
+        TrabalhoSimulacao *trabalho = &trabalhos[t];
+        // Divide as partidas o mais igualmente possível entre as threads
+        trabalho->partidas = configuracao->partidas / quantidadeThreads +
+                             (t < configuracao->partidas % quantidadeThreads ? 1 : 0);
+        trabalho->semente = splitmix64(&sementeBase);
+        trabalho->politica = configuracao->politica;
+        trabalho->modoFrota = configuracao->modoFrota;
+        for (int n = 0; n <= CELULAS_TABULEIRO; n++) {
+            trabalho->histograma[n] = 0;
+        }
+    }
+
+    double inicio = relogioSegundos();
+    int criadas = 0;
+    for (; criadas < quantidadeThreads; criadas++) {
+        if (pthread_create(&threads[criadas], NULL, executarTrabalhoSimulacao,
+                           &trabalhos[criadas]) != 0) {
+            break;
+        }
+    }
+    for (int t = 0; t < criadas; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    double fim = relogioSegundos();
+
+    if (criadas < quantidadeThreads) {
+        liberarAlinhado(trabalhos);
+        return -1;
+    }
+
+    // Junta os histogramas locais só depois que todas as threads terminaram
+    long long somaTiros = 0;
+    resultado->partidas = 0;
+    for (int n = 0; n <= CELULAS_TABULEIRO; n++) {
+        resultado->histograma[n] = 0;
+        for (int t = 0; t < quantidadeThreads; t++) {
+            resultado->histograma[n] += trabalhos[t].histograma[n];
+        }
+        resultado->partidas += resultado->histograma[n];
+        somaTiros += resultado->histograma[n] * n;
+    }
+    resultado->segundos = fim - inicio;
+    resultado->partidasPorSegundo = resultado->segundos > 0 ?
+                                    (double)resultado->partidas / resultado->segundos : 0.0;
+    resultado->mediaTiros = resultado->partidas > 0 ?
+                            (double)somaTiros / (double)resultado->partidas : 0.0;
+    resultado->threadsUsadas = quantidadeThreads;
+
+    liberarAlinhado(trabalhos);
+    return 0;
+}
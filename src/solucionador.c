@@ -0,0 +1,435 @@
+/*
+ * Arquivo: src/solucionador.c
+ * Descrição: Solucionador exato de configurações de frota
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== SOLUCIONADOR EXATO DE CONFIGURAÇÕES DE FROTA ==========
+
+/*
+ * O solucionador percorre a tabela de posicionamentos em ordem e decide, para cada
+ * entrada (camada), se ela faz parte da frota ou não. Escolher os navios sempre em
+ * ordem crescente de índice quebra a simetria entre navios iguais: cada frota é
+ * contada uma única vez, e não 4! vezes.
+ *
+ * Como nenhum posicionamento cobre células anteriores à sua célula inicial, o
+ * futuro da busca depende apenas de quantos navios faltam e de uma janela de
+ * LARGURA_JANELA células a partir da célula inicial da camada. Estados parciais
+ * com a mesma janela são fundidos (memoização), o que transforma a árvore de
+ * busca em um grafo acíclico percorrido duas vezes:
+ *   - para frente, contando os caminhos que chegam a cada estado;
+ *   - para trás, contando as continuações válidas que partem de cada estado.
+ * O produto das duas contagens em cada escolha de navio dá, de uma só vez, o
+ * número exato de frotas que cobrem cada célula.
+ */
+
+// Alcance máximo de um navio a partir da sua célula inicial (23 células no 10x10)
+#define LARGURA_JANELA ((TAMANHO_NAVIO - 1) * (TAMANHO_TABULEIRO + 1) + 1)
+#define BITS_RESTANTES 24  // Posição, na chave do estado, da quantidade de navios restantes
+#define CHAVE_VAZIA UINT32_MAX
+
+/*
+ * Tipo: CamadaSolucionador
+ * Propósito: Estados de uma camada, ordenados pela chave para busca binária
+ * Campos:
+ *   - chaves: janela de ocupação (bits 0 a 22) e navios restantes (bits 24 em diante)
+ *   - caminhos: quantas escolhas anteriores levam a cada estado
+ *   - quantidade: número de estados da camada
+ */
+typedef struct {
+    uint32_t *chaves;
+    uint64_t *caminhos;
+    size_t quantidade;
+} CamadaSolucionador;
+
+// Par (chave, caminhos) usado enquanto uma camada é montada
+typedef struct {
+    uint32_t chave;
+    uint64_t caminhos;
+} EntradaSolucionador;
+
+// Célula inicial da camada: a do posicionamento correspondente, ou o fim do tabuleiro
+static inline int origemCamada(int camada) {
+    if (camada >= quantidadePosicionamentos) {
+        return CELULAS_TABULEIRO;
+    }
+    return INDICE_CELULA(tabelaPosicionamentos[camada].linha,
+                         tabelaPosicionamentos[camada].coluna);
+}
+
+// Extrai LARGURA_JANELA bits do bitboard a partir da célula origem
+static inline uint32_t extrairJanela(Bitboard b, int origem) {
+    uint64_t bits;
+    if (origem >= CELULAS_TABULEIRO) {
+        return 0;
+    }
+    if (origem == 0) {
+        bits = b.palavra[0];
+    } else if (origem < 64) {
+        bits = (b.palavra[0] >> origem) | (b.palavra[1] << (64 - origem));
+    } else {
+        bits = b.palavra[1] >> (origem - 64);
+    }
+    return (uint32_t)(bits & ((1u << LARGURA_JANELA) - 1));
+}
+
+// Quantidade de células do bitboard com índice maior ou igual a origem
+static inline int contarAPartirDe(Bitboard b, int origem) {
+    int total = 0;
+    for (int c = origem; c < CELULAS_TABULEIRO; c++) {
+        total += bitboardContemCelula(b, c);
+    }
+    return total;
+}
+
+// Ordena entradas pela chave (usada por qsort)
+static int compararEntradasSolucionador(const void *a, const void *b) {
+    uint32_t x = ((const EntradaSolucionador *)a)->chave;
+    uint32_t y = ((const EntradaSolucionador *)b)->chave;
+    return (x > y) - (x < y);
+}
+
+// Busca binária de uma chave na camada; retorna o índice ou -1
+static long buscarEstado(const CamadaSolucionador *camada, uint32_t chave) {
+    size_t inicio = 0, fim = camada->quantidade;
+    while (inicio < fim) {
+        size_t meio = inicio + (fim - inicio) / 2;
+        if (camada->chaves[meio] < chave) {
+            inicio = meio + 1;
+        } else {
+            fim = meio;
+        }
+    }
+    return (inicio < camada->quantidade && camada->chaves[inicio] == chave) ? (long)inicio : -1;
+}
+
+/*
+ * Tipo: ContextoSolucionador
+ * Propósito: Dados das observações pré-calculados por camada
+ */
+typedef struct {
+    int origem[MAX_POSICIONAMENTOS + 1];           // Célula inicial de cada camada
+    uint32_t janelaAcertos[MAX_POSICIONAMENTOS + 1]; // Acertos dentro da janela da camada
+    int acertosAPartir[MAX_POSICIONAMENTOS + 1];   // Acertos a partir da célula inicial
+    uint32_t mascaraNavio[MAX_POSICIONAMENTOS];    // Navio da camada, relativo à origem
+    int navioPermitido[MAX_POSICIONAMENTOS];       // 1 se o navio não toca nenhum tiro na água
+} ContextoSolucionador;
+
+/*
+ * Função: transicaoSolucionador
+ * Propósito: Leva a janela de uma camada para a seguinte, conferindo os acertos
+ * Parâmetros:
+ *   - ctx: observações pré-calculadas
+ *   - camada: camada de origem
+ *   - janela: ocupação após a decisão tomada na camada
+ *   - restantes: navios que ainda faltam após a decisão
+ *   - chave: recebe a chave do estado na próxima camada
+ * Retorno: 1 se o estado ainda pode levar a uma frota consistente, 0 se deve ser podado
+ */
+static int transicaoSolucionador(const ContextoSolucionador *ctx, int camada,
+                                 uint32_t janela, int restantes, uint32_t *chave) {
+    int passo = ctx->origem[camada + 1] - ctx->origem[camada];
+    uint64_t saindo = (passo >= 64) ? ~(uint64_t)0 : (((uint64_t)1 << passo) - 1);
+
+    // Um acerto que sai da janela sem navio nunca mais poderá ser coberto
+    if ((ctx->janelaAcertos[camada] & ~janela) & saindo) {
+        return 0;
+    }
+
+    uint32_t proxima = (passo >= 32) ? 0 : (janela >> passo);
+    int pendentes = ctx->acertosAPartir[camada + 1] -
+                    __builtin_popcount(proxima & ctx->janelaAcertos[camada + 1]);
+    // Os navios restantes precisam ser suficientes para cobrir os acertos pendentes
+    if (pendentes > restantes * TAMANHO_NAVIO) {
+        return 0;
+    }
+
+    *chave = proxima | ((uint32_t)restantes << BITS_RESTANTES);
+    return 1;
+}
+
+// Libera os estados de todas as camadas
+static void liberarCamadas(CamadaSolucionador *camadas, int quantidade) {
+    for (int i = 0; i < quantidade; i++) {
+        free(camadas[i].chaves);
+        free(camadas[i].caminhos);
+    }
+    free(camadas);
+}
+
+/*
+ * Função: montarCamada
+ * Propósito: Funde os estados gerados para uma camada e os guarda ordenados
+ * Parâmetros:
+ *   - destino: camada a ser preenchida
+ *   - tabela: tabela hash temporária (chave CHAVE_VAZIA marca posição livre)
+ *   - capacidade: tamanho da tabela hash
+ * Retorno: 0 em caso de sucesso, -1 se faltar memória
+ */
+static int montarCamada(CamadaSolucionador *destino, EntradaSolucionador *tabela,
+                        size_t capacidade) {
+    size_t n = 0;
+    for (size_t k = 0; k < capacidade; k++) {
+        if (tabela[k].chave != CHAVE_VAZIA) {
+            tabela[n++] = tabela[k];  // Compacta no início da própria tabela
+        }
+    }
+    qsort(tabela, n, sizeof(EntradaSolucionador), compararEntradasSolucionador);
+
+    destino->quantidade = n;
+    destino->chaves = malloc((n ? n : 1) * sizeof(uint32_t));
+    destino->caminhos = malloc((n ? n : 1) * sizeof(uint64_t));
+    if (destino->chaves == NULL || destino->caminhos == NULL) {
+        return -1;
+    }
+    for (size_t k = 0; k < n; k++) {
+        destino->chaves[k] = tabela[k].chave;
+        destino->caminhos[k] = tabela[k].caminhos;
+    }
+    return 0;
+}
+
+// Soma caminhos a uma chave na tabela hash temporária (que nunca enche)
+static inline void acumularEstado(EntradaSolucionador *tabela, size_t capacidade,
+                                  uint32_t chave, uint64_t caminhos) {
+    size_t mascara = capacidade - 1;
+    size_t k = (size_t)((chave * 0x9E3779B1u) >> 7) & mascara;
+    while (tabela[k].chave != CHAVE_VAZIA && tabela[k].chave != chave) {
+        k = (k + 1) & mascara;
+    }
+    tabela[k].chave = chave;
+    tabela[k].caminhos += caminhos;
+}
+
+// Probabilidade de navio em cada célula: cobertura / total
+static void calcularProbabilidades(ResultadoSolucionador *resultado) {
+    for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+        resultado->probabilidade[c] = resultado->total > 0
+            ? (double)resultado->cobertura[c] / (double)resultado->total
+            : 0.0;
+    }
+}
+
+/*
+ * Função: resolverConfiguracoes
+ * Propósito: Conta exatamente as frotas de QUANTIDADE_NAVIOS navios consistentes
+ *            com os tiros observados e calcula a probabilidade de navio em cada célula
+ * Parâmetros:
+ *   - agua: tiros que caíram na água (nenhum navio pode cobri-los)
+ *   - acertos: tiros que acertaram navios (todos precisam ser cobertos)
+ *   - resultado: recebe o total, a cobertura e as probabilidades por célula
+ * Retorno: 0 em caso de sucesso, -1 se faltar memória
+ * Nota: O custo cresce com a liberdade do tabuleiro. Posições de fim de jogo são
+ *       resolvidas em milissegundos; o tabuleiro vazio (163.013.051 frotas) leva
+ *       alguns segundos e cerca de 90 MB.
+ */
+int resolverConfiguracoes(Bitboard agua, Bitboard acertos, ResultadoSolucionador *resultado) {
+    inicializarTabelaPosicionamentos();
+
+    int n = quantidadePosicionamentos;
+    int erro = 0;
+    ContextoSolucionador *ctx = malloc(sizeof(ContextoSolucionador));
+    CamadaSolucionador *camadas = calloc((size_t)n + 1, sizeof(CamadaSolucionador));
+    EntradaSolucionador *tabela = NULL;
+    uint64_t *completacoes = NULL, *completacoesSeguintes = NULL;
+    size_t maiorCamada = 1;
+
+    resultado->total = 0;
+    for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+        resultado->cobertura[c] = 0;
+        resultado->probabilidade[c] = 0.0;
+    }
+    if (ctx == NULL || camadas == NULL) {
+        free(ctx);
+        free(camadas);
+        return -1;
+    }
+
+    // Pré-calcula, por camada, as janelas de observação e a máscara relativa do navio
+    for (int i = 0; i <= n; i++) {
+        ctx->origem[i] = origemCamada(i);
+        ctx->janelaAcertos[i] = extrairJanela(acertos, ctx->origem[i]);
+        ctx->acertosAPartir[i] = contarAPartirDe(acertos, ctx->origem[i]);
+    }
+    for (int i = 0; i < n; i++) {
+        const Posicionamento *p = &tabelaPosicionamentos[i];
+        ctx->mascaraNavio[i] = 0;
+        for (int k = 0; k < TAMANHO_NAVIO; k++) {
+            ctx->mascaraNavio[i] |= 1u << (p->celulas[k] - ctx->origem[i]);
+        }
+        ctx->navioPermitido[i] = !bitboardTemInterseccao(p->ocupacao, agua);
+    }
+
+    // ---------- Passo 1: para frente, contando caminhos ----------
+    camadas[0].quantidade = 1;
+    camadas[0].chaves = malloc(sizeof(uint32_t));
+    camadas[0].caminhos = malloc(sizeof(uint64_t));
+    if (camadas[0].chaves == NULL || camadas[0].caminhos == NULL) {
+        erro = 1;
+    } else {
+        camadas[0].chaves[0] = (uint32_t)QUANTIDADE_NAVIOS << BITS_RESTANTES;
+        camadas[0].caminhos[0] = 1;
+    }
+
+    for (int i = 0; i < n && !erro; i++) {
+        const CamadaSolucionador *atual = &camadas[i];
+
+        // Cada estado gera no máximo dois filhos: a tabela fica sempre abaixo de 50%
+        size_t capacidade = 4;
+        while (capacidade < atual->quantidade * 4) {
+            capacidade *= 2;
+        }
+        free(tabela);
+        tabela = malloc(capacidade * sizeof(EntradaSolucionador));
+        if (tabela == NULL) {
+            erro = 1;
+            break;
+        }
+        for (size_t k = 0; k < capacidade; k++) {
+            tabela[k].chave = CHAVE_VAZIA;
+            tabela[k].caminhos = 0;
+        }
+
+        for (size_t k = 0; k < atual->quantidade; k++) {
+            uint32_t janela = atual->chaves[k] & ((1u << LARGURA_JANELA) - 1);
+            int restantes = (int)(atual->chaves[k] >> BITS_RESTANTES);
+            uint32_t chave;
+
+            // Opção 1: este posicionamento não faz parte da frota
+            if (transicaoSolucionador(ctx, i, janela, restantes, &chave)) {
+                acumularEstado(tabela, capacidade, chave, atual->caminhos[k]);
+            }
+            // Opção 2: posiciona o próximo navio aqui, se não tocar água nem outro navio
+            if (restantes > 0 && ctx->navioPermitido[i] && !(janela & ctx->mascaraNavio[i]) &&
+                transicaoSolucionador(ctx, i, janela | ctx->mascaraNavio[i], restantes - 1,
+                                      &chave)) {
+                acumularEstado(tabela, capacidade, chave, atual->caminhos[k]);
+            }
+        }
+
+        if (montarCamada(&camadas[i + 1], tabela, capacidade) != 0) {
+            erro = 1;
+        } else if (camadas[i + 1].quantidade > maiorCamada) {
+            maiorCamada = camadas[i + 1].quantidade;
+        }
+    }
+    free(tabela);
+
+    // ---------- Passo 2: para trás, contando completações e cobertura ----------
+    if (!erro) {
+        completacoes = malloc(maiorCamada * sizeof(uint64_t));
+        completacoesSeguintes = malloc(maiorCamada * sizeof(uint64_t));
+        erro = (completacoes == NULL || completacoesSeguintes == NULL);
+    }
+
+    if (!erro) {
+        // Na última camada, só o estado sem navios restantes é uma frota completa
+        for (size_t k = 0; k < camadas[n].quantidade; k++) {
+            completacoesSeguintes[k] = (camadas[n].chaves[k] >> BITS_RESTANTES) == 0;
+        }
+
+        for (int i = n - 1; i >= 0; i--) {
+            const CamadaSolucionador *atual = &camadas[i];
+            const Posicionamento *p = &tabelaPosicionamentos[i];
+
+            for (size_t k = 0; k < atual->quantidade; k++) {
+                uint32_t janela = atual->chaves[k] & ((1u << LARGURA_JANELA) - 1);
+                int restantes = (int)(atual->chaves[k] >> BITS_RESTANTES);
+                uint32_t chave;
+                long filho;
+
+                completacoes[k] = 0;
+                if (transicaoSolucionador(ctx, i, janela, restantes, &chave) &&
+                    (filho = buscarEstado(&camadas[i + 1], chave)) >= 0) {
+                    completacoes[k] += completacoesSeguintes[filho];
+                }
+                if (restantes > 0 && ctx->navioPermitido[i] &&
+                    !(janela & ctx->mascaraNavio[i]) &&
+                    transicaoSolucionador(ctx, i, janela | ctx->mascaraNavio[i], restantes - 1,
+                                          &chave) &&
+                    (filho = buscarEstado(&camadas[i + 1], chave)) >= 0) {
+                    // Frotas que passam por esta escolha: caminhos até aqui x continuações
+                    uint64_t frotas = atual->caminhos[k] * completacoesSeguintes[filho];
+                    completacoes[k] += completacoesSeguintes[filho];
+                    for (int c = 0; c < TAMANHO_NAVIO; c++) {
+                        resultado->cobertura[p->celulas[c]] += frotas;
+                    }
+                }
+            }
+
+            // A camada atual passa a ser a "seguinte" da próxima iteração
+            uint64_t *troca = completacoes;
+            completacoes = completacoesSeguintes;
+            completacoesSeguintes = troca;
+        }
+
+        resultado->total = completacoesSeguintes[0];  // Camada 0 tem um único estado
+        calcularProbabilidades(resultado);
+    }
+
+    free(completacoes);
+    free(completacoesSeguintes);
+    liberarCamadas(camadas, n + 1);
+    free(ctx);
+    return erro ? -1 : 0;
+}
+
+// ========== SOLUCIONADOR COM TABELA DE TRANSPOSIÇÃO ==========
+
+/*
+ * Função: resolverConfiguracoesEmCache
+ * Propósito: resolverConfiguracoes com os resultados guardados em uma tabela de
+ *            transposição indexada por hashObservacao: a mesma posição alcançada
+ *            por outra ordem de tiros é resolvida sem recontar as frotas
+ * Parâmetros:
+ *   - cache: tabela criada com PALAVRAS_RESULTADO_SOLUCIONADOR palavras por entrada
+ *            (pode ser compartilhada entre threads)
+ *   - agua, acertos, resultado: os de resolverConfiguracoes
+ * Retorno: 0 em caso de sucesso, -1 se a tabela for incompatível ou faltar memória
+ */
+int resolverConfiguracoesEmCache(TabelaTransposicao *cache, Bitboard agua, Bitboard acertos,
+                                 ResultadoSolucionador *resultado) {
+    uint64_t dados[PALAVRAS_RESULTADO_SOLUCIONADOR];
+    uint64_t chave = hashObservacao(agua, acertos);
+
+    if (palavrasTabelaTransposicao(cache) != PALAVRAS_RESULTADO_SOLUCIONADOR) {
+        return -1;
+    }
+    if (consultarTransposicao(cache, chave, dados)) {
+        resultado->total = dados[0];
+        memcpy(resultado->cobertura, &dados[1], sizeof(resultado->cobertura));
+        calcularProbabilidades(resultado);
+        return 0;
+    }
+
+    if (resolverConfiguracoes(agua, acertos, resultado) != 0) {
+        return -1;
+    }
+    dados[0] = resultado->total;
+    memcpy(&dados[1], resultado->cobertura, sizeof(resultado->cobertura));
+    gravarTransposicao(cache, chave, dados);
+    return 0;
+}
+
+/*
+ * Função: semearCacheSolucionador
+ * Propósito: Grava no cache o resultado do tabuleiro sem nenhum tiro, calculado de
+ *            antemão (por exemplo, pela enumeração exaustiva de layouts), para que
+ *            a primeira jogada de cada partida não precise resolvê-lo
+ * Parâmetros:
+ *   - cache: tabela criada com PALAVRAS_RESULTADO_SOLUCIONADOR palavras de dados
+ *   - priori: total e cobertura de cada célula sem observações
+ * Retorno: 0 em caso de sucesso, -1 se a tabela tiver outro formato de entrada
+ */
+int semearCacheSolucionador(TabelaTransposicao *cache, const ResultadoSolucionador *priori) {
+    uint64_t dados[PALAVRAS_RESULTADO_SOLUCIONADOR];
+
+    if (palavrasTabelaTransposicao(cache) != PALAVRAS_RESULTADO_SOLUCIONADOR) {
+        return -1;
+    }
+    dados[0] = priori->total;
+    memcpy(&dados[1], priori->cobertura, sizeof(priori->cobertura));
+    gravarTransposicao(cache, hashObservacao(bitboardVazio(), bitboardVazio()), dados);
+    return 0;
+}
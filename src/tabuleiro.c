@@ -0,0 +1,251 @@
+/*
+ * Arquivo: src/tabuleiro.c
+ * Descrição: Funções sobre a matriz 10x10 tradicional (aceleradas pelas tabelas do motor em bits)
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== FUNÇÕES SOBRE A MATRIZ TRADICIONAL ==========
+
+// As funções operam direto sobre a matriz, tocando apenas as células envolvidas;
+// a tabela de posicionamentos e as máscaras do motor em bits dizem quais são.
+// Valores de célula diferentes de AGUA, NAVIO e HABILIDADE são preservados.
+
+/*
+ * Função: inicializarTabuleiro
+ * Propósito: Inicializa todas as posições do tabuleiro com o valor 0 (água)
+ * Parâmetros:
+ *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
+ * Retorno: void (não retorna valor)
+ */
+void inicializarTabuleiro(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]) {
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            tabuleiro[i][j] = AGUA;
+        }
+    }
+}
+
+// Corpo de validarPosicao, separado para que a medição envolva um único retorno
+static int validarLimites(int linha, int coluna, int tamanho, char orientacao) {
+    // Caminho rápido: navios do tamanho padrão são validados pela tabela
+    if (tamanho == TAMANHO_NAVIO) {
+        return consultarPosicionamento(linha, coluna, orientacao) != NULL;
+    }
+
+    // Valida se a linha e coluna iniciais estão dentro do tabuleiro
+    if (linha < 0 || linha >= TAMANHO_TABULEIRO ||
+        coluna < 0 || coluna >= TAMANHO_TABULEIRO) {
+        return 0;  // Posição inicial inválida
+    }
+
+    // Valida orientação horizontal
+    if (orientacao == 'H' || orientacao == 'h') {
+        // Verifica se o navio cabe horizontalmente
+        if (coluna + tamanho > TAMANHO_TABULEIRO) {
+            return 0;  // Navio ultrapassa o limite à direita
+        }
+    }
+    // Valida orientação vertical
+    else if (orientacao == 'V' || orientacao == 'v') {
+        // Verifica se o navio cabe verticalmente
+        if (linha + tamanho > TAMANHO_TABULEIRO) {
+            return 0;  // Navio ultrapassa o limite inferior
+        }
+    }
+    // Valida orientação diagonal para baixo-direita (↘)
+    else if (orientacao == 'D' || orientacao == 'd') {
+        // Verifica se o navio cabe na diagonal (linha e coluna aumentam)
+        if (linha + tamanho > TAMANHO_TABULEIRO ||
+            coluna + tamanho > TAMANHO_TABULEIRO) {
+            return 0;  // Navio ultrapassa os limites
+        }
+    }
+    // Valida orientação diagonal para baixo-esquerda (↙)
+    else if (orientacao == 'E' || orientacao == 'e') {
+        // Verifica se o navio cabe na diagonal (linha aumenta, coluna diminui)
+        if (linha + tamanho > TAMANHO_TABULEIRO ||
+            coluna - tamanho + 1 < 0) {
+            return 0;  // Navio ultrapassa os limites
+        }
+    }
+    else {
+        return 0;  // Orientação inválida
+    }
+
+    return 1;  // Posição válida
+}
+
+/*
+ * Função: validarPosicao
+ * Propósito: Verifica se um navio cabe dentro dos limites do tabuleiro
+ * Parâmetros:
+ *   - linha: linha inicial do navio
+ *   - coluna: coluna inicial do navio
+ *   - tamanho: quantidade de posições que o navio ocupa
+ *   - orientacao: 'H' para horizontal, 'V' para vertical,
+ *                 'D' para diagonal baixo-direita, 'E' para diagonal baixo-esquerda
+ * Retorno: 1 se a posição é válida, 0 se é inválida
+ */
+int validarPosicao(int linha, int coluna, int tamanho, char orientacao) {
+    INSTRUMENTAR_INICIO();
+    int valida = validarLimites(linha, coluna, tamanho, orientacao);
+    INSTRUMENTAR_FIM(PONTO_VALIDAR_POSICAO, !valida);
+    return valida;
+}
+
+// Corpo de verificarSobreposicao, separado para que a medição envolva um único retorno
+static int celulasOcupadas(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                           int linha, int coluna, int tamanho, char orientacao) {
+    const int *celulas = &tabuleiro[0][0];
+    int passoLinha, passoColuna;
+
+    // Caminho rápido: navios do tamanho padrão leem as células listadas na tabela
+    if (tamanho == TAMANHO_NAVIO) {
+        const Posicionamento *p = consultarPosicionamento(linha, coluna, orientacao);
+        if (p != NULL) {
+            return celulas[p->celulas[0]] != AGUA || celulas[p->celulas[1]] != AGUA ||
+                   celulas[p->celulas[2]] != AGUA;
+        }
+    }
+
+    if (!obterDeslocamentoOrientacao(orientacao, &passoLinha, &passoColuna)) {
+        return 0;  // Orientação inválida: nenhuma célula a conferir
+    }
+    for (int i = 0; i < tamanho; i++) {
+        if (tabuleiro[linha + i * passoLinha][coluna + i * passoColuna] != AGUA) {
+            return 1;  // Há sobreposição
+        }
+    }
+    return 0;  // Não há sobreposição
+}
+
+/*
+ * Função: verificarSobreposicao
+ * Propósito: Verifica se as posições que o navio ocupará já estão ocupadas
+ * Parâmetros:
+ *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
+ *   - linha: linha inicial do navio
+ *   - coluna: coluna inicial do navio
+ *   - tamanho: quantidade de posições que o navio ocupa
+ *   - orientacao: 'H' para horizontal, 'V' para vertical,
+ *                 'D' para diagonal baixo-direita, 'E' para diagonal baixo-esquerda
+ * Retorno: 1 se houver sobreposição, 0 se estiver livre
+ * Nota: Assume que validarPosicao já confirmou que o navio cabe no tabuleiro
+ */
+int verificarSobreposicao(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                          int linha, int coluna, int tamanho, char orientacao) {
+    INSTRUMENTAR_INICIO();
+    int sobreposto = celulasOcupadas(tabuleiro, linha, coluna, tamanho, orientacao);
+    INSTRUMENTAR_FIM(PONTO_VERIFICAR_SOBREPOSICAO, sobreposto);
+    return sobreposto;
+}
+
+/*
+ * Função: posicionarNavio
+ * Propósito: Posiciona um navio no tabuleiro, marcando suas posições com o valor 3
+ * Parâmetros:
+ *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
+ *   - linha: linha inicial do navio
+ *   - coluna: coluna inicial do navio
+ *   - orientacao: 'H' para horizontal, 'V' para vertical,
+ *                 'D' para diagonal baixo-direita, 'E' para diagonal baixo-esquerda
+ * Retorno: void (não retorna valor)
+ * Nota: Assume que a validação já foi feita antes de chamar esta função
+ */
+void posicionarNavio(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                     int linha, int coluna, char orientacao) {
+    INSTRUMENTAR_INICIO();
+    const Posicionamento *p = consultarPosicionamento(linha, coluna, orientacao);
+    int *celulas = &tabuleiro[0][0];
+
+    // Orientação inválida ou navio fora do tabuleiro: nada a marcar
+    if (p != NULL) {
+        for (int k = 0; k < TAMANHO_NAVIO; k++) {
+            celulas[p->celulas[k]] = NAVIO;
+        }
+    }
+    INSTRUMENTAR_FIM(PONTO_POSICIONAR_NAVIO, 0);
+}
+
+/*
+ * Função: copiarTabuleiro
+ * Propósito: Cria uma cópia do tabuleiro para preservar o original
+ * Parâmetros:
+ *   - origem: matriz 10x10 que será copiada
+ *   - destino: matriz 10x10 que receberá a cópia
+ * Retorno: void (não retorna valor)
+ */
+void copiarTabuleiro(int origem[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                     int destino[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]) {
+    memcpy(destino, origem, sizeof(int) * CELULAS_TABULEIRO);
+}
+
+/*
+ * Função: criarMatrizCone
+ * Propósito: Preenche uma matriz representando área de efeito em forma de cone
+ * Parâmetros:
+ *   - matriz: matriz 7x7 que receberá o padrão de cone
+ * Retorno: void (não retorna valor)
+ * Lógica: O cone expande do topo (linha 0) para baixo, aumentando largura.
+ *         O padrão vem pronto da forma clássica montada em tempo de compilação.
+ */
+void criarMatrizCone(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]) {
+    expandirForma(obterForma(FORMA_CONE, RAIO_CLASSICO), matriz);
+}
+
+/*
+ * Função: criarMatrizCruz
+ * Propósito: Preenche uma matriz representando área de efeito em forma de cruz
+ * Parâmetros:
+ *   - matriz: matriz 7x7 que receberá o padrão de cruz
+ * Retorno: void (não retorna valor)
+ * Lógica: Marca linha central E coluna central, formando uma cruz.
+ *         O padrão vem pronto da forma clássica montada em tempo de compilação.
+ */
+void criarMatrizCruz(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]) {
+    expandirForma(obterForma(FORMA_CRUZ, RAIO_CLASSICO), matriz);
+}
+
+/*
+ * Função: criarMatrizOctaedro
+ * Propósito: Preenche uma matriz representando área de efeito em forma de losango
+ * Parâmetros:
+ *   - matriz: matriz 7x7 que receberá o padrão de losango (vista frontal de octaedro)
+ * Retorno: void (não retorna valor)
+ * Lógica: Distância Manhattan até o centro menor ou igual ao raio (formato de diamante).
+ *         O padrão vem pronto da forma clássica montada em tempo de compilação.
+ */
+void criarMatrizOctaedro(int matriz[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE]) {
+    expandirForma(obterForma(FORMA_OCTAEDRO, RAIO_CLASSICO), matriz);
+}
+
+/*
+ * Função: aplicarHabilidade
+ * Propósito: Sobrepõe a matriz de habilidade no tabuleiro, centrando no ponto de origem
+ * Parâmetros:
+ *   - tabuleiro: matriz 10x10 que representa o tabuleiro do jogo
+ *   - matrizHabilidade: matriz 7x7 representando a área de efeito
+ *   - origem_linha: linha central onde a habilidade será aplicada
+ *   - origem_coluna: coluna central onde a habilidade será aplicada
+ * Retorno: void (não retorna valor)
+ * Lógica: A área já recortada nos limites vem de mascaraHabilidade; só as células
+ *         marcadas nela são visitadas, e apenas as de água mudam
+ */
+void aplicarHabilidade(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                       int matrizHabilidade[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE],
+                       int origem_linha, int origem_coluna) {
+    INSTRUMENTAR_INICIO();
+    Bitboard area = mascaraHabilidade(matrizHabilidade, origem_linha, origem_coluna);
+    int *celulas = &tabuleiro[0][0];
+
+    for (int p = 0; p < 2; p++) {
+        for (uint64_t bits = area.palavra[p]; bits; bits &= bits - 1) {
+            int *celula = &celulas[p * 64 + __builtin_ctzll(bits)];
+            if (*celula == AGUA) {
+                *celula = HABILIDADE;
+            }
+        }
+    }
+    INSTRUMENTAR_FIM(PONTO_APLICAR_HABILIDADE, 0);
+}
@@ -0,0 +1,256 @@
+/*
+ * Arquivo: src/tabuleiro_bits.c
+ * Descrição: Motor do tabuleiro em bits (máscaras, navios, habilidades e tiros)
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== MÁSCARAS DE NAVIOS E HABILIDADES ==========
+
+/*
+ * Função: obterDeslocamentoOrientacao
+ * Propósito: Traduz a orientação do navio no passo (linha, coluna) entre suas células
+ * Parâmetros:
+ *   - orientacao: 'H', 'V', 'D' ou 'E' (maiúsculas ou minúsculas)
+ *   - passoLinha: recebe o incremento de linha entre células consecutivas
+ *   - passoColuna: recebe o incremento de coluna entre células consecutivas
+ * Retorno: 1 se a orientação é conhecida, 0 caso contrário
+ */
+int obterDeslocamentoOrientacao(char orientacao, int *passoLinha, int *passoColuna) {
+    switch (orientacao) {
+        case 'H': case 'h': *passoLinha = 0; *passoColuna = 1;  return 1;  // Horizontal (→)
+        case 'V': case 'v': *passoLinha = 1; *passoColuna = 0;  return 1;  // Vertical (↓)
+        case 'D': case 'd': *passoLinha = 1; *passoColuna = 1;  return 1;  // Diagonal (↘)
+        case 'E': case 'e': *passoLinha = 1; *passoColuna = -1; return 1;  // Diagonal (↙)
+        default: return 0;  // Orientação inválida
+    }
+}
+
+/*
+ * Função: mascaraNavio
+ * Propósito: Monta o bitboard com as células ocupadas por um navio
+ * Parâmetros:
+ *   - linha: linha inicial do navio
+ *   - coluna: coluna inicial do navio
+ *   - tamanho: quantidade de posições que o navio ocupa
+ *   - orientacao: 'H', 'V', 'D' ou 'E'
+ * Retorno: bitboard com as células do navio (vazio se a orientação for inválida)
+ * Nota: Assume que validarPosicao já confirmou que o navio cabe no tabuleiro
+ */
+Bitboard mascaraNavio(int linha, int coluna, int tamanho, char orientacao) {
+    Bitboard mascara = bitboardVazio();
+    int passoLinha, passoColuna;
+
+    if (!obterDeslocamentoOrientacao(orientacao, &passoLinha, &passoColuna)) {
+        return mascara;
+    }
+
+    for (int i = 0; i < tamanho; i++) {
+        mascara = bitboardOu(mascara,
+                             bitboardCelula(INDICE_CELULA(linha + i * passoLinha,
+                                                          coluna + i * passoColuna)));
+    }
+    return mascara;
+}
+
+/*
+ * Função: mascaraHabilidade
+ * Propósito: Converte uma matriz de habilidade 7x7 no bitboard da área afetada,
+ *            centrada no ponto de origem e recortada nos limites do tabuleiro
+ * Parâmetros:
+ *   - matrizHabilidade: matriz 7x7 com 1 nas posições afetadas
+ *   - origem_linha: linha central da habilidade
+ *   - origem_coluna: coluna central da habilidade
+ * Retorno: bitboard com as células do tabuleiro cobertas pela habilidade
+ * Lógica: Cada linha da matriz vira uma palavra de 7 bits sem desvios por célula;
+ *         as colunas são recortadas com um deslocamento e uma máscara e a linha
+ *         inteira é posicionada no bitboard de uma vez, como em mascaraForma.
+ */
+Bitboard mascaraHabilidade(int matrizHabilidade[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE],
+                           int origem_linha, int origem_coluna) {
+    int deslocamento = TAMANHO_MATRIZ_HABILIDADE / 2;
+    int primeiraColuna = origem_coluna - deslocamento;  // Coluna do bit 0 de cada linha
+    Bitboard mascara = bitboardVazio();
+
+    if (primeiraColuna >= TAMANHO_TABULEIRO || primeiraColuna <= -TAMANHO_MATRIZ_HABILIDADE) {
+        return mascara;  // Nenhuma coluna da matriz cai no tabuleiro
+    }
+
+    // Recorte das linhas: intervalo [inicio, fim) de linhas da matriz
+    int linhaInicio = deslocamento - origem_linha > 0 ? deslocamento - origem_linha : 0;
+    int linhaFim = TAMANHO_TABULEIRO - origem_linha + deslocamento;
+    if (linhaFim > TAMANHO_MATRIZ_HABILIDADE) linhaFim = TAMANHO_MATRIZ_HABILIDADE;
+
+    for (int i = linhaInicio; i < linhaFim; i++) {
+        uint64_t bits = 0;
+        for (int j = 0; j < TAMANHO_MATRIZ_HABILIDADE; j++) {
+            bits |= (uint64_t)(matrizHabilidade[i][j] == 1) << j;
+        }
+        bits = primeiraColuna >= 0 ? bits << primeiraColuna : bits >> -primeiraColuna;
+        bits &= ((uint64_t)1 << TAMANHO_TABULEIRO) - 1;  // Recorta as colunas excedentes
+        mascara = bitboardOu(mascara, bitboardLinha(origem_linha - deslocamento + i, bits));
+    }
+    return mascara;
+}
+
+// ========== MOTOR DO TABULEIRO EM BITS ==========
+
+/*
+ * Função: inicializarTabuleiroBits
+ * Propósito: Zera todas as camadas do tabuleiro (todas as células viram água)
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits a ser inicializado
+ * Retorno: void (não retorna valor)
+ */
+void inicializarTabuleiroBits(TabuleiroBits *tabuleiro) {
+    tabuleiro->navios = bitboardVazio();
+    tabuleiro->habilidade = bitboardVazio();
+    tabuleiro->tiros = bitboardVazio();
+    tabuleiro->hash = 0;
+}
+
+/*
+ * Função: verificarSobreposicaoBits
+ * Propósito: Verifica com um único AND se o navio cobriria alguma célula que não é água
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits
+ *   - linha, coluna: posição inicial do navio
+ *   - tamanho: quantidade de posições que o navio ocupa
+ *   - orientacao: 'H', 'V', 'D' ou 'E'
+ * Retorno: 1 se houver sobreposição, 0 se estiver livre
+ */
+int verificarSobreposicaoBits(const TabuleiroBits *tabuleiro,
+                              int linha, int coluna, int tamanho, char orientacao) {
+    INSTRUMENTAR_INICIO();
+    Bitboard ocupadas = bitboardOu(tabuleiro->navios, tabuleiro->habilidade);
+    const Posicionamento *p = NULL;
+
+    // Caminho rápido: navios do tamanho padrão usam a máscara pré-calculada
+    if (tamanho == TAMANHO_NAVIO) {
+        p = consultarPosicionamento(linha, coluna, orientacao);
+    }
+    int sobreposto = bitboardTemInterseccao(ocupadas, p != NULL ? p->ocupacao
+                                            : mascaraNavio(linha, coluna, tamanho, orientacao));
+    INSTRUMENTAR_FIM(PONTO_VERIFICAR_SOBREPOSICAO, sobreposto);
+    return sobreposto;
+}
+
+/*
+ * Função: posicionarNavioBits
+ * Propósito: Posiciona um navio com um único OR na camada de navios
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits
+ *   - linha, coluna: posição inicial do navio
+ *   - orientacao: 'H', 'V', 'D' ou 'E'
+ * Retorno: void (não retorna valor)
+ * Nota: Assume que a validação já foi feita. Assim como na matriz, o navio
+ *       sobrescreve qualquer área de habilidade nas células que ocupa.
+ */
+void posicionarNavioBits(TabuleiroBits *tabuleiro, int linha, int coluna, char orientacao) {
+    INSTRUMENTAR_INICIO();
+    const Posicionamento *p = consultarPosicionamento(linha, coluna, orientacao);
+    Bitboard navio = p != NULL ? p->ocupacao
+                               : mascaraNavio(linha, coluna, TAMANHO_NAVIO, orientacao);
+    tabuleiro->hash ^= hashCamadaZobrist(ZOBRIST_NAVIOS, bitboardENao(navio, tabuleiro->navios)) ^
+                       hashCamadaZobrist(ZOBRIST_HABILIDADE, bitboardE(navio, tabuleiro->habilidade));
+    tabuleiro->navios = bitboardOu(tabuleiro->navios, navio);
+    tabuleiro->habilidade = bitboardENao(tabuleiro->habilidade, navio);
+    INSTRUMENTAR_FIM(PONTO_POSICIONAR_NAVIO, 0);
+}
+
+/*
+ * Função: aplicarHabilidadeBits
+ * Propósito: Marca a área da habilidade nas células de água (navios são preservados)
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits
+ *   - matrizHabilidade: matriz 7x7 representando a área de efeito
+ *   - origem_linha, origem_coluna: ponto central da habilidade
+ * Retorno: void (não retorna valor)
+ */
+void aplicarHabilidadeBits(TabuleiroBits *tabuleiro,
+                           int matrizHabilidade[TAMANHO_MATRIZ_HABILIDADE][TAMANHO_MATRIZ_HABILIDADE],
+                           int origem_linha, int origem_coluna) {
+    INSTRUMENTAR_INICIO();
+    Bitboard area = mascaraHabilidade(matrizHabilidade, origem_linha, origem_coluna);
+    Bitboard novas = bitboardENao(bitboardENao(area, tabuleiro->navios), tabuleiro->habilidade);
+    tabuleiro->habilidade = bitboardOu(tabuleiro->habilidade, novas);
+    tabuleiro->hash ^= hashCamadaZobrist(ZOBRIST_HABILIDADE, novas);
+    INSTRUMENTAR_FIM(PONTO_APLICAR_HABILIDADE, 0);
+}
+
+/*
+ * Função: copiarTabuleiroBits
+ * Propósito: Copia um tabuleiro em bits (56 bytes, sem laços)
+ * Parâmetros:
+ *   - origem: tabuleiro que será copiado
+ *   - destino: tabuleiro que receberá a cópia
+ * Retorno: void (não retorna valor)
+ */
+void copiarTabuleiroBits(const TabuleiroBits *origem, TabuleiroBits *destino) {
+    *destino = *origem;
+}
+
+/*
+ * Função: registrarTiroBits
+ * Propósito: Marca um tiro na camada de tiros do tabuleiro
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits
+ *   - celula: índice da célula atingida (INDICE_CELULA)
+ * Retorno: 1 se o tiro acertou um navio, 0 se caiu na água
+ */
+int registrarTiroBits(TabuleiroBits *tabuleiro, int celula) {
+    Bitboard tiro = bitboardENao(bitboardCelula(celula), tabuleiro->tiros);  // Vazio se repetido
+    tabuleiro->tiros = bitboardOu(tabuleiro->tiros, tiro);
+    tabuleiro->hash ^= hashCamadaZobrist(ZOBRIST_TIROS, tiro);
+    return bitboardContemCelula(tabuleiro->navios, celula);
+}
+
+/*
+ * Função: compactarTabuleiro
+ * Propósito: Converte a matriz 10x10 tradicional no tabuleiro em bits
+ * Parâmetros:
+ *   - tabuleiro: matriz 10x10 com valores AGUA, NAVIO ou HABILIDADE
+ *   - destino: tabuleiro em bits que receberá o resultado
+ * Retorno: void (não retorna valor)
+ * Nota: Qualquer outro valor de célula vira água; as funções da matriz tradicional
+ *       não passam por aqui e preservam esses valores.
+ */
+void compactarTabuleiro(int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO],
+                        TabuleiroBits *destino) {
+    inicializarTabuleiroBits(destino);
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            if (tabuleiro[i][j] == NAVIO) {
+                destino->navios = bitboardOu(destino->navios, bitboardCelula(INDICE_CELULA(i, j)));
+            } else if (tabuleiro[i][j] == HABILIDADE) {
+                destino->habilidade = bitboardOu(destino->habilidade,
+                                                 bitboardCelula(INDICE_CELULA(i, j)));
+            }
+        }
+    }
+    destino->hash = hashTabuleiroBits(destino);
+}
+
+/*
+ * Função: expandirTabuleiro
+ * Propósito: Converte o tabuleiro em bits de volta para a matriz 10x10 tradicional
+ * Parâmetros:
+ *   - origem: tabuleiro em bits
+ *   - tabuleiro: matriz 10x10 que receberá os valores AGUA, NAVIO ou HABILIDADE
+ * Retorno: void (não retorna valor)
+ */
+void expandirTabuleiro(const TabuleiroBits *origem,
+                       int tabuleiro[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]) {
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            int indice = INDICE_CELULA(i, j);
+            if (bitboardContemCelula(origem->navios, indice)) {
+                tabuleiro[i][j] = NAVIO;
+            } else if (bitboardContemCelula(origem->habilidade, indice)) {
+                tabuleiro[i][j] = HABILIDADE;
+            } else {
+                tabuleiro[i][j] = AGUA;
+            }
+        }
+    }
+}
@@ -0,0 +1,865 @@
+/*
+ * Arquivo: src/tabuleiro_dinamico.c
+ * Descrição: Tabuleiro com dimensões definidas em tempo de execução e kernels SIMD
+ */
+
+#include "batalha_naval_interno.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define BATALHA_NAVAL_X86 1  // Habilita os kernels SSE2/AVX2 com detecção em tempo de execução
+#endif
+
+// ========== TABULEIRO COM DIMENSÕES DEFINIDAS EM TEMPO DE EXECUÇÃO ==========
+
+#define TENTATIVAS_POR_NAVIO 10000  // Sorteios antes de desistir de posicionar um navio
+
+// Confere as dimensões e preenche largura, altura e passo; retorna os bytes do buffer ou 0
+static size_t dimensionarTabuleiroDinamico(TabuleiroDinamico *tabuleiro, int largura, int altura) {
+    tabuleiro->celulas = NULL;
+    tabuleiro->arena = NULL;
+    if (largura <= 0 || altura <= 0 || largura > INT32_MAX - ALINHAMENTO_CACHE) {
+        return 0;
+    }
+
+    tabuleiro->largura = largura;
+    tabuleiro->altura = altura;
+    tabuleiro->passo = (largura + ALINHAMENTO_CACHE - 1) / ALINHAMENTO_CACHE * ALINHAMENTO_CACHE;
+    return (size_t)tabuleiro->passo * (size_t)altura;
+}
+
+/*
+ * Função: criarTabuleiroDinamico
+ * Propósito: Aloca um tabuleiro largura x altura preenchido com água
+ * Parâmetros:
+ *   - tabuleiro: estrutura que receberá o tabuleiro
+ *   - largura, altura: dimensões (maiores que zero)
+ * Retorno: 0 em caso de sucesso, -1 se as dimensões forem inválidas ou faltar memória
+ */
+int criarTabuleiroDinamico(TabuleiroDinamico *tabuleiro, int largura, int altura) {
+    size_t bytes = dimensionarTabuleiroDinamico(tabuleiro, largura, altura);
+    if (bytes == 0 || (tabuleiro->celulas = alocarAlinhado(bytes)) == NULL) {
+        return -1;
+    }
+
+    memset(tabuleiro->celulas, AGUA, bytes);
+    return 0;
+}
+
+/*
+ * Função: criarTabuleiroDinamicoNaArena
+ * Propósito: Como criarTabuleiroDinamico, mas com o buffer retirado de uma arena
+ * Parâmetros:
+ *   - tabuleiro: estrutura que receberá o tabuleiro
+ *   - arena: arena de origem; o tabuleiro some junto com as alocações da arena
+ *   - largura, altura: dimensões (maiores que zero)
+ * Retorno: 0 em caso de sucesso, -1 se as dimensões forem inválidas ou faltar memória
+ * Nota: liberarTabuleiroDinamico não devolve o buffer; ele é descartado por
+ *       voltarArena, reiniciarArena ou liberarArena.
+ */
+int criarTabuleiroDinamicoNaArena(TabuleiroDinamico *tabuleiro, Arena *arena,
+                                  int largura, int altura) {
+    size_t bytes = dimensionarTabuleiroDinamico(tabuleiro, largura, altura);
+    if (bytes == 0 || (tabuleiro->celulas = alocarArena(arena, bytes)) == NULL) {
+        return -1;
+    }
+
+    tabuleiro->arena = arena;
+    memset(tabuleiro->celulas, AGUA, bytes);
+    return 0;
+}
+
+/*
+ * Função: liberarTabuleiroDinamico
+ * Propósito: Devolve a memória de um tabuleiro criado por criarTabuleiroDinamico
+ *            (tabuleiros em arena apenas deixam de apontar para o buffer)
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro a ser liberado
+ * Retorno: void (não retorna valor)
+ */
+void liberarTabuleiroDinamico(TabuleiroDinamico *tabuleiro) {
+    if (tabuleiro->arena == NULL) {
+        liberarAlinhado(tabuleiro->celulas);
+    }
+    tabuleiro->celulas = NULL;
+}
+
+/*
+ * Função: inicializarTabuleiroDinamico
+ * Propósito: Volta todas as células do tabuleiro para água
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro já criado
+ * Retorno: void (não retorna valor)
+ */
+void inicializarTabuleiroDinamico(TabuleiroDinamico *tabuleiro) {
+    memset(tabuleiro->celulas, AGUA, (size_t)tabuleiro->passo * (size_t)tabuleiro->altura);
+}
+
+/*
+ * Função: copiarTabuleiroDinamico
+ * Propósito: Copia um tabuleiro para outro de mesmas dimensões
+ * Parâmetros:
+ *   - origem: tabuleiro que será copiado
+ *   - destino: tabuleiro que receberá a cópia
+ * Retorno: 0 em caso de sucesso, -1 se as dimensões forem diferentes
+ */
+int copiarTabuleiroDinamico(const TabuleiroDinamico *origem, TabuleiroDinamico *destino) {
+    if (origem->largura != destino->largura || origem->altura != destino->altura) {
+        return -1;
+    }
+    memcpy(destino->celulas, origem->celulas, (size_t)origem->passo * (size_t)origem->altura);
+    return 0;
+}
+
+/*
+ * Função: validarPosicaoDinamico
+ * Propósito: Verifica se um navio de qualquer tamanho cabe no tabuleiro
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro de destino (apenas as dimensões são usadas)
+ *   - linha, coluna: posição inicial do navio
+ *   - tamanho: quantidade de posições que o navio ocupa
+ *   - orientacao: 'H', 'V', 'D' ou 'E'
+ * Retorno: 1 se a posição é válida, 0 se é inválida
+ */
+int validarPosicaoDinamico(const TabuleiroDinamico *tabuleiro,
+                           int linha, int coluna, int tamanho, char orientacao) {
+    int passoLinha, passoColuna;
+
+    if (tamanho <= 0 || !obterDeslocamentoOrientacao(orientacao, &passoLinha, &passoColuna)) {
+        return 0;
+    }
+    if (linha < 0 || linha >= tabuleiro->altura || coluna < 0 || coluna >= tabuleiro->largura) {
+        return 0;  // Posição inicial fora do tabuleiro
+    }
+
+    // Nenhuma orientação volta para trás: basta conferir a última célula
+    long ultimaLinha = linha + (long)(tamanho - 1) * passoLinha;
+    long ultimaColuna = coluna + (long)(tamanho - 1) * passoColuna;
+    return ultimaLinha < tabuleiro->altura && ultimaColuna >= 0 &&
+           ultimaColuna < tabuleiro->largura;
+}
+
+/*
+ * Função: verificarSobreposicaoDinamico
+ * Propósito: Verifica se alguma célula do navio já não é água
+ * Parâmetros: os mesmos de validarPosicaoDinamico
+ * Retorno: 1 se houver sobreposição, 0 se estiver livre
+ * Nota: Assume que validarPosicaoDinamico já confirmou os limites
+ */
+int verificarSobreposicaoDinamico(const TabuleiroDinamico *tabuleiro,
+                                  int linha, int coluna, int tamanho, char orientacao) {
+    int passoLinha, passoColuna;
+    obterDeslocamentoOrientacao(orientacao, &passoLinha, &passoColuna);
+
+    for (int i = 0; i < tamanho; i++) {
+        if (*celulaDinamica(tabuleiro, linha + i * passoLinha, coluna + i * passoColuna) != AGUA) {
+            return 1;  // Há sobreposição
+        }
+    }
+    return 0;  // Não há sobreposição
+}
+
+// Grava valor nas células de um navio (NAVIO para posicionar, AGUA para retirar)
+static void preencherNavioDinamico(TabuleiroDinamico *tabuleiro, int linha, int coluna,
+                                   int tamanho, char orientacao, unsigned char valor) {
+    int passoLinha, passoColuna;
+    obterDeslocamentoOrientacao(orientacao, &passoLinha, &passoColuna);
+
+    for (int i = 0; i < tamanho; i++) {
+        *celulaDinamica(tabuleiro, linha + i * passoLinha, coluna + i * passoColuna) = valor;
+    }
+}
+
+/*
+ * Função: posicionarNavioDinamico
+ * Propósito: Marca as células de um navio de qualquer tamanho com NAVIO
+ * Parâmetros: os mesmos de validarPosicaoDinamico
+ * Retorno: void (não retorna valor)
+ * Nota: Assume que a validação já foi feita antes de chamar esta função
+ */
+void posicionarNavioDinamico(TabuleiroDinamico *tabuleiro,
+                             int linha, int coluna, int tamanho, char orientacao) {
+    preencherNavioDinamico(tabuleiro, linha, coluna, tamanho, orientacao, NAVIO);
+}
+
+// ---------- Kernels de aplicação de habilidade por linha ----------
+
+// Assinatura comum: grava HABILIDADE onde a matriz vale 1 e a célula é AGUA
+typedef void (*FuncaoLinhaHabilidade)(unsigned char *linhaTabuleiro,
+                                      const unsigned char *linhaMatriz, int largura);
+
+// Versão escalar, usada em qualquer CPU e para as sobras dos kernels vetoriais
+static void aplicarLinhaHabilidadeEscalar(unsigned char *linhaTabuleiro,
+                                          const unsigned char *linhaMatriz, int largura) {
+    for (int j = 0; j < largura; j++) {
+        if (linhaMatriz[j] == 1 && linhaTabuleiro[j] == AGUA) {
+            linhaTabuleiro[j] = HABILIDADE;
+        }
+    }
+}
+
+#ifdef BATALHA_NAVAL_X86
+// Carimba 16 células com SSE2; o "blend" é feito com AND/ANDNOT/OR
+__attribute__((target("sse2")))
+static inline void carimbarDezesseisSSE2(unsigned char *linhaTabuleiro,
+                                         const unsigned char *linhaMatriz) {
+    __m128i matriz = _mm_loadu_si128((const __m128i *)linhaMatriz);
+    __m128i celulas = _mm_loadu_si128((const __m128i *)linhaTabuleiro);
+    __m128i marcar = _mm_and_si128(_mm_cmpeq_epi8(matriz, _mm_set1_epi8(1)),
+                                   _mm_cmpeq_epi8(celulas, _mm_set1_epi8(AGUA)));
+    celulas = _mm_or_si128(_mm_and_si128(marcar, _mm_set1_epi8(HABILIDADE)),
+                           _mm_andnot_si128(marcar, celulas));
+    _mm_storeu_si128((__m128i *)linhaTabuleiro, celulas);
+}
+
+// Carimba 8 células com SSE2 (_mm_loadl_epi64/_mm_storel_epi64)
+__attribute__((target("sse2")))
+static inline void carimbarOitoSSE2(unsigned char *linhaTabuleiro,
+                                    const unsigned char *linhaMatriz) {
+    __m128i matriz = _mm_loadl_epi64((const __m128i *)linhaMatriz);
+    __m128i celulas = _mm_loadl_epi64((const __m128i *)linhaTabuleiro);
+    __m128i marcar = _mm_and_si128(_mm_cmpeq_epi8(matriz, _mm_set1_epi8(1)),
+                                   _mm_cmpeq_epi8(celulas, _mm_set1_epi8(AGUA)));
+    celulas = _mm_or_si128(_mm_and_si128(marcar, _mm_set1_epi8(HABILIDADE)),
+                           _mm_andnot_si128(marcar, celulas));
+    _mm_storel_epi64((__m128i *)linhaTabuleiro, celulas);
+}
+
+// Sobra de uma linha com pelo menos 8 células e menos de 16 a partir de j: carimbar
+// de novo células já tratadas não muda nada (HABILIDADE não é água), então as
+// janelas finais podem se sobrepor às anteriores em vez de cair no laço escalar
+__attribute__((target("sse2")))
+static inline void carimbarSobraSSE2(unsigned char *linhaTabuleiro,
+                                     const unsigned char *linhaMatriz, int j, int largura) {
+    if (largura >= 16) {
+        carimbarDezesseisSSE2(linhaTabuleiro + largura - 16, linhaMatriz + largura - 16);
+        return;
+    }
+    if (j + 8 < largura) {
+        carimbarOitoSSE2(linhaTabuleiro + j, linhaMatriz + j);
+    }
+    carimbarOitoSSE2(linhaTabuleiro + largura - 8, linhaMatriz + largura - 8);
+}
+
+// SSE2: 16 células por iteração; linhas de 8 a 15 células usam janelas de 8 bytes
+__attribute__((target("sse2")))
+static void aplicarLinhaHabilidadeSSE2(unsigned char *linhaTabuleiro,
+                                       const unsigned char *linhaMatriz, int largura) {
+    int j = 0;
+
+    if (largura < 8) {
+        aplicarLinhaHabilidadeEscalar(linhaTabuleiro, linhaMatriz, largura);
+        return;
+    }
+    for (; j + 16 <= largura; j += 16) {
+        carimbarDezesseisSSE2(linhaTabuleiro + j, linhaMatriz + j);
+    }
+    if (j < largura) {
+        carimbarSobraSSE2(linhaTabuleiro, linhaMatriz, j, largura);
+    }
+}
+
+// Carimba 32 células com AVX2, com compare-and-blend (vpblendvb)
+__attribute__((target("avx2")))
+static inline void carimbarTrintaEDoisAVX2(unsigned char *linhaTabuleiro,
+                                           const unsigned char *linhaMatriz) {
+    __m256i matriz = _mm256_loadu_si256((const __m256i *)linhaMatriz);
+    __m256i celulas = _mm256_loadu_si256((const __m256i *)linhaTabuleiro);
+    __m256i marcar = _mm256_and_si256(_mm256_cmpeq_epi8(matriz, _mm256_set1_epi8(1)),
+                                      _mm256_cmpeq_epi8(celulas, _mm256_set1_epi8(AGUA)));
+    _mm256_storeu_si256((__m256i *)linhaTabuleiro,
+                        _mm256_blendv_epi8(celulas, _mm256_set1_epi8(HABILIDADE), marcar));
+}
+
+// AVX2: 32 células por iteração; a sobra é uma janela de 32 sobreposta à anterior
+__attribute__((target("avx2")))
+static void aplicarLinhaHabilidadeAVX2(unsigned char *linhaTabuleiro,
+                                       const unsigned char *linhaMatriz, int largura) {
+    int j = 0;
+
+    if (largura < 8) {
+        aplicarLinhaHabilidadeEscalar(linhaTabuleiro, linhaMatriz, largura);
+        return;
+    }
+    for (; j + 32 <= largura; j += 32) {
+        carimbarTrintaEDoisAVX2(linhaTabuleiro + j, linhaMatriz + j);
+    }
+    if (j < largura && largura >= 32) {
+        carimbarTrintaEDoisAVX2(linhaTabuleiro + largura - 32, linhaMatriz + largura - 32);
+        j = largura;
+    }
+    // Linhas de 8 a 31 células: as mesmas janelas do kernel SSE2, aqui com codificação
+    // VEX (chamar o kernel SSE2 com a metade alta dos registradores suja custaria uma
+    // transição AVX-SSE por linha)
+    for (; j + 16 <= largura; j += 16) {
+        carimbarDezesseisSSE2(linhaTabuleiro + j, linhaMatriz + j);
+    }
+    if (j < largura) {
+        carimbarSobraSSE2(linhaTabuleiro, linhaMatriz, j, largura);
+    }
+    _mm256_zeroupper();
+}
+
+/*
+ * Função: aplicarJanelaCurtaSSE2
+ * Propósito: Carimba uma janela com menos de 8 colunas (as matrizes 7x7 clássicas)
+ *            com um único acesso de 8 bytes por linha
+ * Parâmetros:
+ *   - tabuleiro, matriz: destino e área de efeito (matriz com pelo menos 8 células)
+ *   - linhaInicio, linhaFim: intervalo [inicio, fim) de linhas da matriz
+ *   - colunaInicio, largura: colunas da matriz dentro da janela (largura < 8)
+ *   - linhaTabuleiro, colunaTabuleiro: célula do tabuleiro sob a linha linhaInicio
+ *                                      e a coluna colunaInicio da matriz
+ * Retorno: void (não retorna valor)
+ * Lógica: Os 8 bytes lidos nunca saem dos buffers: o acesso recua para a esquerda
+ *         quando a janela está no fim da linha do tabuleiro (que tem pelo menos
+ *         64 bytes de passo) ou no fim da matriz. Deslocamentos de 64 bits alinham
+ *         as duas janelas, e uma máscara restringe as marcações às "largura"
+ *         células pedidas; os demais bytes são regravados com o valor lido.
+ */
+__attribute__((target("sse2")))
+static void aplicarJanelaCurtaSSE2(TabuleiroDinamico *tabuleiro,
+                                   const MatrizHabilidadeDinamica *matriz,
+                                   int linhaInicio, int linhaFim, int colunaInicio, int largura,
+                                   int linhaTabuleiro, int colunaTabuleiro) {
+    const __m128i um = _mm_set1_epi8(1);
+    const __m128i agua = _mm_set1_epi8(AGUA);
+    const __m128i habilidade = _mm_set1_epi8(HABILIDADE);
+    const __m128i faixa = _mm_srl_epi64(_mm_set1_epi8(-1), _mm_cvtsi32_si128(64 - 8 * largura));
+    size_t totalMatriz = (size_t)matriz->tamanho * (size_t)matriz->tamanho;
+    int recuoTabuleiro = colunaTabuleiro + 8 > tabuleiro->passo
+                             ? colunaTabuleiro + 8 - tabuleiro->passo : 0;
+    __m128i deslocamentoTabuleiro = _mm_cvtsi32_si128(8 * recuoTabuleiro);
+
+    for (int i = linhaInicio; i < linhaFim; i++, linhaTabuleiro++) {
+        size_t posicao = (size_t)i * (size_t)matriz->tamanho + (size_t)colunaInicio;
+        int recuoMatriz = posicao + 8 > totalMatriz ? (int)(posicao + 8 - totalMatriz) : 0;
+        unsigned char *janela = celulaDinamica(tabuleiro, linhaTabuleiro,
+                                               colunaTabuleiro - recuoTabuleiro);
+
+        __m128i linhaMatriz = _mm_srl_epi64(
+            _mm_loadl_epi64((const __m128i *)(matriz->celulas + posicao - (size_t)recuoMatriz)),
+            _mm_cvtsi32_si128(8 * recuoMatriz));
+        __m128i celulas = _mm_loadl_epi64((const __m128i *)janela);
+        __m128i marcar = _mm_and_si128(
+            _mm_and_si128(_mm_cmpeq_epi8(linhaMatriz, um),
+                          _mm_cmpeq_epi8(_mm_srl_epi64(celulas, deslocamentoTabuleiro), agua)),
+            faixa);
+        marcar = _mm_sll_epi64(marcar, deslocamentoTabuleiro);
+        celulas = _mm_or_si128(_mm_and_si128(marcar, habilidade), _mm_andnot_si128(marcar, celulas));
+        _mm_storel_epi64((__m128i *)janela, celulas);
+    }
+}
+#endif
+
+static FuncaoLinhaHabilidade kernelLinhaHabilidade = aplicarLinhaHabilidadeEscalar;
+static KernelHabilidade kernelHabilidadeDetectado = KERNEL_ESCALAR;
+static pthread_once_t deteccaoKernelHabilidade = PTHREAD_ONCE_INIT;
+
+// Escolhe, uma única vez, o kernel mais rápido suportado pela CPU
+static void detectarKernelHabilidade(void) {
+#ifdef BATALHA_NAVAL_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        kernelLinhaHabilidade = aplicarLinhaHabilidadeAVX2;
+        kernelHabilidadeDetectado = KERNEL_AVX2;
+    } else if (__builtin_cpu_supports("sse2")) {
+        kernelLinhaHabilidade = aplicarLinhaHabilidadeSSE2;
+        kernelHabilidadeDetectado = KERNEL_SSE2;
+    }
+#endif
+}
+
+/*
+ * Função: obterKernelHabilidade
+ * Propósito: Informa qual kernel aplicarHabilidadeDinamico usa nesta CPU
+ * Retorno: KERNEL_ESCALAR, KERNEL_SSE2 ou KERNEL_AVX2
+ */
+KernelHabilidade obterKernelHabilidade(void) {
+    pthread_once(&deteccaoKernelHabilidade, detectarKernelHabilidade);
+    return kernelHabilidadeDetectado;
+}
+
+// Função de linha correspondente ao kernel pedido (recai no escalar se não houver suporte)
+static FuncaoLinhaHabilidade funcaoKernelHabilidade(KernelHabilidade kernel) {
+    KernelHabilidade detectado = obterKernelHabilidade();
+    switch (kernel) {
+        case KERNEL_AUTOMATICO:
+            return kernelLinhaHabilidade;
+#ifdef BATALHA_NAVAL_X86
+        case KERNEL_SSE2:
+            return detectado >= KERNEL_SSE2 ? aplicarLinhaHabilidadeSSE2
+                                            : aplicarLinhaHabilidadeEscalar;
+        case KERNEL_AVX2:
+            return detectado >= KERNEL_AVX2 ? aplicarLinhaHabilidadeAVX2
+                                            : aplicarLinhaHabilidadeEscalar;
+#endif
+        default:
+            (void)detectado;
+            return aplicarLinhaHabilidadeEscalar;
+    }
+}
+
+/*
+ * Função: aplicarHabilidadeDinamicoComKernel
+ * Propósito: Sobrepõe uma matriz de habilidade de qualquer tamanho, centrada na
+ *            origem, usando o kernel de linha indicado
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro de destino
+ *   - matriz: área de efeito
+ *   - origem_linha, origem_coluna: ponto central da habilidade
+ *   - kernel: KERNEL_AUTOMATICO ou um kernel específico (para testes e medições)
+ * Retorno: void (não retorna valor)
+ * Lógica: A janela é recortada nos limites do tabuleiro uma única vez; depois
+ *         cada linha é carimbada inteira pelo kernel, sem testes de limite.
+ *         Navios não são sobrescritos.
+ */
+void aplicarHabilidadeDinamicoComKernel(TabuleiroDinamico *tabuleiro,
+                                        const MatrizHabilidadeDinamica *matriz,
+                                        int origem_linha, int origem_coluna,
+                                        KernelHabilidade kernel) {
+    FuncaoLinhaHabilidade aplicarLinha = funcaoKernelHabilidade(kernel);
+    int deslocamento = matriz->tamanho / 2;
+
+    // Recorte da janela: intervalo [inicio, fim) de linhas e colunas da matriz
+    int linhaInicio = deslocamento - origem_linha > 0 ? deslocamento - origem_linha : 0;
+    int colunaInicio = deslocamento - origem_coluna > 0 ? deslocamento - origem_coluna : 0;
+    int linhaFim = tabuleiro->altura - origem_linha + deslocamento;
+    int colunaFim = tabuleiro->largura - origem_coluna + deslocamento;
+    if (linhaFim > matriz->tamanho) linhaFim = matriz->tamanho;
+    if (colunaFim > matriz->tamanho) colunaFim = matriz->tamanho;
+
+    int larguraJanela = colunaFim - colunaInicio;
+    if (larguraJanela <= 0) {
+        return;  // Habilidade inteiramente fora do tabuleiro
+    }
+
+#ifdef BATALHA_NAVAL_X86
+    // Janelas estreitas não enchem nem 8 bytes por linha: os kernels vetoriais as
+    // tratam com um acesso de 8 bytes por linha, recuado para dentro dos buffers
+    if (larguraJanela < 8 && aplicarLinha != aplicarLinhaHabilidadeEscalar &&
+        matriz->tamanho * matriz->tamanho >= 8) {
+        aplicarJanelaCurtaSSE2(tabuleiro, matriz, linhaInicio, linhaFim, colunaInicio,
+                               larguraJanela, origem_linha - deslocamento + linhaInicio,
+                               origem_coluna - deslocamento + colunaInicio);
+        return;
+    }
+#endif
+
+    for (int i = linhaInicio; i < linhaFim; i++) {
+        const unsigned char *linhaMatriz = matriz->celulas + (size_t)i * (size_t)matriz->tamanho +
+                                           (size_t)colunaInicio;
+        unsigned char *linhaTabuleiro = celulaDinamica(tabuleiro, origem_linha - deslocamento + i,
+                                                       origem_coluna - deslocamento + colunaInicio);
+        aplicarLinha(linhaTabuleiro, linhaMatriz, larguraJanela);
+    }
+}
+
+/*
+ * Função: aplicarHabilidadeDinamico
+ * Propósito: Sobrepõe uma matriz de habilidade de qualquer tamanho, centrada na origem
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro de destino
+ *   - matriz: área de efeito
+ *   - origem_linha, origem_coluna: ponto central da habilidade
+ * Retorno: void (não retorna valor)
+ * Nota: Usa o kernel vetorial mais rápido disponível (AVX2, SSE2 ou escalar)
+ */
+void aplicarHabilidadeDinamico(TabuleiroDinamico *tabuleiro, const MatrizHabilidadeDinamica *matriz,
+                               int origem_linha, int origem_coluna) {
+    aplicarHabilidadeDinamicoComKernel(tabuleiro, matriz, origem_linha, origem_coluna,
+                                       KERNEL_AUTOMATICO);
+}
+
+/*
+ * Função: aplicarFormaDinamico
+ * Propósito: Sobrepõe uma forma do registro em um tabuleiro dinâmico
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro de destino
+ *   - forma: forma do registro
+ *   - origem_linha, origem_coluna: ponto central da habilidade
+ * Retorno: void (não retorna valor)
+ * Lógica: Cada linha de bits é recortada nas colunas do tabuleiro com uma máscara
+ *         e só os bits ligados são visitados. Navios não são sobrescritos.
+ */
+void aplicarFormaDinamico(TabuleiroDinamico *tabuleiro, const FormaHabilidade *forma,
+                          int origem_linha, int origem_coluna) {
+    int primeiraColuna = origem_coluna - forma->raio;
+    int colunaInicio = primeiraColuna < 0 ? -primeiraColuna : 0;
+    int colunaFim = tabuleiro->largura - primeiraColuna;
+    if (colunaFim > forma->tamanho) colunaFim = forma->tamanho;
+    if (colunaFim <= colunaInicio) {
+        return;  // Nenhuma coluna da forma cai no tabuleiro
+    }
+
+    uint64_t recorte = FAIXA_BITS(colunaInicio, colunaFim - colunaInicio);
+    for (int i = 0; i < forma->tamanho; i++) {
+        int linha = origem_linha - forma->raio + i;
+        if (linha < 0 || linha >= tabuleiro->altura) {
+            continue;
+        }
+
+        uint64_t bits = forma->linhas[i] & recorte;
+        unsigned char *linhaTabuleiro = celulaDinamica(tabuleiro, linha, 0);
+        while (bits) {
+            int j = __builtin_ctzll(bits);  // Próxima posição afetada
+            unsigned char *celula = &linhaTabuleiro[primeiraColuna + j];
+            if (*celula == AGUA) {
+                *celula = HABILIDADE;
+            }
+            bits &= bits - 1;
+        }
+    }
+}
+
+// ---------- Aplicação de vários efeitos em uma única passada ----------
+
+#define LOTE_EFEITOS_DINAMICO 64     // Efeitos decididos e ordenados juntos (na pilha)
+#define PALAVRAS_UNIAO_DINAMICO 64   // Largura máxima de um grupo varrido: 4096 colunas
+#define CUSTO_LINHA_VARREDURA 6      // Células repetidas que pagam uma linha de efeito varrida
+
+// Efeito de um lote já convertido para o canto superior esquerdo da sua área
+typedef struct {
+    const FormaHabilidade *forma;
+    int primeiraLinha;   // Pode ser negativa (área recortada acima)
+    int primeiraColuna;  // Pode ser negativa (área recortada à esquerda)
+} EfeitoLote;
+
+/*
+ * Função: varrerGrupoEfeitosDinamico
+ * Propósito: Marca HABILIDADE na união das áreas de um grupo de efeitos,
+ *            escrevendo cada linha do tabuleiro uma única vez
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro de destino
+ *   - grupo: efeitos ordenados pela primeira linha
+ *   - quantidade: número de efeitos do grupo
+ *   - palavraBase: primeira palavra de 64 colunas tocada pelo grupo; o grupo
+ *                  cabe em PALAVRAS_UNIAO_DINAMICO palavras a partir dela
+ * Retorno: void (não retorna valor)
+ * Lógica: As linhas são varridas com uma lista de efeitos ativos: cada efeito
+ *         entra na sua primeira linha e sai depois da última. Em cada linha, os
+ *         bits dos efeitos ativos são somados com OR por palavra, e cada célula
+ *         da união é visitada uma vez.
+ */
+static void varrerGrupoEfeitosDinamico(TabuleiroDinamico *tabuleiro, const EfeitoLote *grupo,
+                                       int quantidade, int palavraBase) {
+    EfeitoLote ativos[LOTE_EFEITOS_DINAMICO];
+    uint64_t uniao[PALAVRAS_UNIAO_DINAMICO + 1] = {0};  // +1: transbordo da última palavra
+    int quantidadeAtivos = 0;
+    int proximo = 0;
+    int linha = grupo[0].primeiraLinha < 0 ? 0 : grupo[0].primeiraLinha;
+
+    while ((proximo < quantidade || quantidadeAtivos > 0) && linha < tabuleiro->altura) {
+        while (proximo < quantidade && grupo[proximo].primeiraLinha <= linha) {
+            ativos[quantidadeAtivos++] = grupo[proximo++];
+        }
+
+        int menorPalavra = PALAVRAS_UNIAO_DINAMICO;
+        int maiorPalavra = -1;
+        for (int a = 0; a < quantidadeAtivos;) {
+            const FormaHabilidade *forma = ativos[a].forma;
+            int i = linha - ativos[a].primeiraLinha;
+            int primeiraColuna = ativos[a].primeiraColuna;
+            if (i >= forma->tamanho) {
+                ativos[a] = ativos[--quantidadeAtivos];  // Efeito terminou: sai da lista
+                continue;
+            }
+            a++;
+
+            // Recorta a linha da forma nas colunas do tabuleiro
+            uint64_t bits = forma->linhas[i];
+            if (primeiraColuna < 0) {
+                bits >>= -primeiraColuna;
+                primeiraColuna = 0;
+            }
+            if (tabuleiro->largura - primeiraColuna < 64) {
+                bits &= FAIXA_BITS(0, tabuleiro->largura - primeiraColuna);
+            }
+
+            // A linha recortada cai em uma palavra ou atravessa duas
+            int palavra = (primeiraColuna >> 6) - palavraBase;
+            int deslocamento = primeiraColuna & 63;
+            uniao[palavra] |= bits << deslocamento;
+            uniao[palavra + 1] |= deslocamento != 0 ? bits >> (64 - deslocamento) : 0;
+            if (palavra < menorPalavra) menorPalavra = palavra;
+            if (palavra + 1 > maiorPalavra) maiorPalavra = palavra + 1;
+        }
+
+        unsigned char *linhaTabuleiro = celulaDinamica(tabuleiro, linha, palavraBase * 64);
+        for (int palavra = menorPalavra; palavra <= maiorPalavra; palavra++) {
+            unsigned char *trecho = linhaTabuleiro + palavra * 64;
+            for (uint64_t bits = uniao[palavra]; bits; bits &= bits - 1) {
+                unsigned char *celula = &trecho[__builtin_ctzll(bits)];
+                if (*celula == AGUA) {
+                    *celula = HABILIDADE;
+                }
+            }
+            uniao[palavra] = 0;
+        }
+        linha++;
+    }
+}
+
+// Retângulo coberto por um conjunto de efeitos e o trabalho de aplicá-los um a um
+typedef struct {
+    int primeiraLinha, ultimaLinha;  // [primeiraLinha, ultimaLinha)
+    int menorColuna, maiorColuna;    // [menorColuna, maiorColuna)
+    int64_t celulas;                 // Soma das células das formas
+    int64_t linhasEfeitos;           // Soma das linhas das formas
+} ExtensaoEfeitos;
+
+static void iniciarExtensao(ExtensaoEfeitos *extensao, const EfeitoLote *efeito) {
+    extensao->primeiraLinha = efeito->primeiraLinha;
+    extensao->ultimaLinha = efeito->primeiraLinha + efeito->forma->tamanho;
+    extensao->menorColuna = efeito->primeiraColuna;
+    extensao->maiorColuna = efeito->primeiraColuna + efeito->forma->tamanho;
+    extensao->celulas = efeito->forma->celulas;
+    extensao->linhasEfeitos = efeito->forma->tamanho;
+}
+
+static void incluirNaExtensao(ExtensaoEfeitos *extensao, const EfeitoLote *efeito) {
+    int ultimaLinha = efeito->primeiraLinha + efeito->forma->tamanho;
+    int maiorColuna = efeito->primeiraColuna + efeito->forma->tamanho;
+    if (efeito->primeiraLinha < extensao->primeiraLinha) extensao->primeiraLinha = efeito->primeiraLinha;
+    if (ultimaLinha > extensao->ultimaLinha) extensao->ultimaLinha = ultimaLinha;
+    if (efeito->primeiraColuna < extensao->menorColuna) extensao->menorColuna = efeito->primeiraColuna;
+    if (maiorColuna > extensao->maiorColuna) extensao->maiorColuna = maiorColuna;
+    extensao->celulas += efeito->forma->celulas;
+    extensao->linhasEfeitos += efeito->forma->tamanho;
+}
+
+// Verdadeiro se a varredura compensa: as células repetidas (além do retângulo,
+// recortado no tabuleiro) pagam CUSTO_LINHA_VARREDURA por linha de efeito e o
+// retângulo cabe na união da pilha
+static int compensaVarredura(const TabuleiroDinamico *tabuleiro, const ExtensaoEfeitos *extensao) {
+    int primeiraLinha = extensao->primeiraLinha < 0 ? 0 : extensao->primeiraLinha;
+    int ultimaLinha = extensao->ultimaLinha;
+    int menorColuna = extensao->menorColuna < 0 ? 0 : extensao->menorColuna;
+    int maiorColuna = extensao->maiorColuna;
+    if (ultimaLinha > tabuleiro->altura) ultimaLinha = tabuleiro->altura;
+    if (maiorColuna > tabuleiro->largura) maiorColuna = tabuleiro->largura;
+    int64_t area = (int64_t)(ultimaLinha - primeiraLinha) * (maiorColuna - menorColuna);
+    return ((maiorColuna - 1) >> 6) - (menorColuna >> 6) < PALAVRAS_UNIAO_DINAMICO &&
+           extensao->celulas - area > CUSTO_LINHA_VARREDURA * extensao->linhasEfeitos;
+}
+
+/*
+ * Função: aplicarLoteEfeitosDinamico
+ * Propósito: Marca HABILIDADE nas áreas de até LOTE_EFEITOS_DINAMICO efeitos
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro de destino
+ *   - efeitos: lista de efeitos
+ *   - quantidade: número de efeitos (até LOTE_EFEITOS_DINAMICO)
+ * Retorno: void (não retorna valor)
+ * Lógica: A varredura linha a linha só compensa quando muitas células se repetem
+ *         (compensaVarredura): com poucas células por linha, aplicarFormaDinamico,
+ *         que visita só as células de cada efeito, é mais rápida. Se o lote
+ *         inteiro não se sobrepõe o bastante, os efeitos são aplicados um a um,
+ *         sem ordenar. Caso contrário, são ordenados pela primeira linha e
+ *         separados em grupos cujas linhas se encadeiam; cada grupo é varrido ou
+ *         aplicado efeito a efeito pelo mesmo critério.
+ */
+static void aplicarLoteEfeitosDinamico(TabuleiroDinamico *tabuleiro,
+                                       const EfeitoHabilidade *efeitos, int quantidade) {
+    EfeitoLote lote[LOTE_EFEITOS_DINAMICO];
+    ExtensaoEfeitos extensao;
+    int quantidadeLote = 0;
+
+    for (int e = 0; e < quantidade; e++) {
+        EfeitoLote efeito = {efeitos[e].forma, efeitos[e].linha - efeitos[e].forma->raio,
+                             efeitos[e].coluna - efeitos[e].forma->raio};
+        if (e == 0) {
+            iniciarExtensao(&extensao, &efeito);
+        } else {
+            incluirNaExtensao(&extensao, &efeito);
+        }
+    }
+    if (quantidade < 2 || !compensaVarredura(tabuleiro, &extensao)) {
+        for (int e = 0; e < quantidade; e++) {
+            aplicarFormaDinamico(tabuleiro, efeitos[e].forma, efeitos[e].linha, efeitos[e].coluna);
+        }
+        return;
+    }
+
+    // Ordena (por inserção) pela primeira linha os efeitos com alguma célula no tabuleiro
+    for (int e = 0; e < quantidade; e++) {
+        EfeitoLote efeito = {efeitos[e].forma, efeitos[e].linha - efeitos[e].forma->raio,
+                             efeitos[e].coluna - efeitos[e].forma->raio};
+        if (efeito.primeiraLinha >= tabuleiro->altura ||
+            efeito.primeiraLinha <= -efeito.forma->tamanho ||
+            efeito.primeiraColuna >= tabuleiro->largura ||
+            efeito.primeiraColuna <= -efeito.forma->tamanho) {
+            continue;
+        }
+        int k = quantidadeLote++;
+        while (k > 0 && lote[k - 1].primeiraLinha > efeito.primeiraLinha) {
+            lote[k] = lote[k - 1];
+            k--;
+        }
+        lote[k] = efeito;
+    }
+
+    for (int inicio = 0, fim; inicio < quantidadeLote; inicio = fim) {
+        // Grupo: efeitos seguidos cujas faixas de linhas se encadeiam
+        iniciarExtensao(&extensao, &lote[inicio]);
+        for (fim = inicio + 1; fim < quantidadeLote && lote[fim].primeiraLinha < extensao.ultimaLinha;
+             fim++) {
+            incluirNaExtensao(&extensao, &lote[fim]);
+        }
+        if (fim - inicio > 1 && compensaVarredura(tabuleiro, &extensao)) {
+            int menorColuna = extensao.menorColuna < 0 ? 0 : extensao.menorColuna;
+            varrerGrupoEfeitosDinamico(tabuleiro, lote + inicio, fim - inicio, menorColuna >> 6);
+            continue;
+        }
+        for (int e = inicio; e < fim; e++) {
+            aplicarFormaDinamico(tabuleiro, lote[e].forma, lote[e].primeiraLinha + lote[e].forma->raio,
+                                 lote[e].primeiraColuna + lote[e].forma->raio);
+        }
+    }
+}
+
+/*
+ * Função: aplicarEfeitosDinamico
+ * Propósito: Resolve uma lista de efeitos de habilidade em um tabuleiro dinâmico, sem cópias
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro de destino
+ *   - efeitos: lista de efeitos (forma e origem)
+ *   - quantidade: número de efeitos
+ *   - contagem: NULL para marcar HABILIDADE no tabuleiro; caso contrário, vetor de
+ *               altura * largura posições (linha a linha, sem o preenchimento de
+ *               passo) que recebe quantos efeitos atingem cada célula, sem alterar
+ *               o tabuleiro
+ * Retorno: void (não retorna valor)
+ * Lógica: Sem contagem, os efeitos são tratados em lotes de LOTE_EFEITOS_DINAMICO
+ *         (aplicarLoteEfeitosDinamico): onde as áreas se sobrepõem o bastante, a
+ *         união é montada por linha e cada linha do tabuleiro é escrita uma só
+ *         vez, como em aplicarEfeitosBits; no resto, cada efeito visita só as suas
+ *         células. Nenhuma memória é alocada.
+ */
+void aplicarEfeitosDinamico(TabuleiroDinamico *tabuleiro, const EfeitoHabilidade *efeitos,
+                            int quantidade, uint32_t *contagem) {
+    if (contagem == NULL) {
+        for (int e = 0; e < quantidade; e += LOTE_EFEITOS_DINAMICO) {
+            int lote = quantidade - e < LOTE_EFEITOS_DINAMICO ? quantidade - e
+                                                              : LOTE_EFEITOS_DINAMICO;
+            aplicarLoteEfeitosDinamico(tabuleiro, efeitos + e, lote);
+        }
+        return;
+    }
+
+    memset(contagem, 0, (size_t)tabuleiro->largura * (size_t)tabuleiro->altura * sizeof(uint32_t));
+    for (int e = 0; e < quantidade; e++) {
+        const FormaHabilidade *forma = efeitos[e].forma;
+        int primeiraColuna = efeitos[e].coluna - forma->raio;
+        int colunaInicio = primeiraColuna < 0 ? -primeiraColuna : 0;
+        int colunaFim = tabuleiro->largura - primeiraColuna;
+        if (colunaFim > forma->tamanho) colunaFim = forma->tamanho;
+        if (colunaFim <= colunaInicio) {
+            continue;
+        }
+
+        uint64_t recorte = FAIXA_BITS(colunaInicio, colunaFim - colunaInicio);
+        for (int i = 0; i < forma->tamanho; i++) {
+            int linha = efeitos[e].linha - forma->raio + i;
+            if (linha < 0 || linha >= tabuleiro->altura) {
+                continue;
+            }
+            uint32_t *linhaContagem = contagem + (size_t)linha * (size_t)tabuleiro->largura;
+            for (uint64_t bits = forma->linhas[i] & recorte; bits; bits &= bits - 1) {
+                linhaContagem[primeiraColuna + __builtin_ctzll(bits)]++;
+            }
+        }
+    }
+}
+
+/*
+ * Função: especificacaoFrotaClassica
+ * Propósito: Retorna a frota de main(): QUANTIDADE_NAVIOS navios de TAMANHO_NAVIO posições
+ * Retorno: especificação preenchida
+ */
+EspecificacaoFrota especificacaoFrotaClassica(void) {
+    EspecificacaoFrota especificacao;
+    especificacao.quantidade = QUANTIDADE_NAVIOS;
+    for (int n = 0; n < QUANTIDADE_NAVIOS; n++) {
+        especificacao.tamanhos[n] = TAMANHO_NAVIO;
+    }
+    return especificacao;
+}
+
+/*
+ * Função: posicionarFrotaDinamica
+ * Propósito: Sorteia e posiciona uma frota mista em um tabuleiro dinâmico
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro de destino (já inicializado)
+ *   - especificacao: tamanhos dos navios
+ *   - gerador: gerador pseudoaleatório
+ * Retorno: 0 em caso de sucesso, -1 se algum navio não couber após
+ *          TENTATIVAS_POR_NAVIO sorteios
+ * Nota: Na falha, os navios já posicionados são retirados e o tabuleiro volta
+ *       ao estado de entrada (só o gerador avança)
+ */
+int posicionarFrotaDinamica(TabuleiroDinamico *tabuleiro, const EspecificacaoFrota *especificacao,
+                            GeradorAleatorio *gerador) {
+    // Posições sorteadas, para desfazer a frota parcial se um navio não couber
+    int linhas[MAX_NAVIOS_FROTA];
+    int colunas[MAX_NAVIOS_FROTA];
+    char orientacoes[MAX_NAVIOS_FROTA];
+
+    for (int n = 0; n < especificacao->quantidade; n++) {
+        int tamanho = especificacao->tamanhos[n];
+        int posicionado = 0;
+
+        for (int tentativa = 0; tentativa < TENTATIVAS_POR_NAVIO && !posicionado; tentativa++) {
+            int linha = (int)aleatorioAte(gerador, (uint32_t)tabuleiro->altura);
+            int coluna = (int)aleatorioAte(gerador, (uint32_t)tabuleiro->largura);
+            char orientacao = ORIENTACOES[aleatorioAte(gerador, QUANTIDADE_ORIENTACOES)];
+
+            if (validarPosicaoDinamico(tabuleiro, linha, coluna, tamanho, orientacao) &&
+                !verificarSobreposicaoDinamico(tabuleiro, linha, coluna, tamanho, orientacao)) {
+                posicionarNavioDinamico(tabuleiro, linha, coluna, tamanho, orientacao);
+                linhas[n] = linha;
+                colunas[n] = coluna;
+                orientacoes[n] = orientacao;
+                posicionado = 1;
+            }
+        }
+        if (!posicionado) {
+            // Os navios só ocupam água: devolvê-la restaura o tabuleiro
+            for (int p = n - 1; p >= 0; p--) {
+                preencherNavioDinamico(tabuleiro, linhas[p], colunas[p], especificacao->tamanhos[p],
+                                       orientacoes[p], AGUA);
+            }
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Função: compactarTabuleiroDinamico
+ * Propósito: Converte um tabuleiro dinâmico 10x10 para o caminho rápido em bits
+ * Parâmetros:
+ *   - origem: tabuleiro dinâmico
+ *   - destino: tabuleiro em bits
+ * Retorno: 0 em caso de sucesso, -1 se o tabuleiro não for 10x10
+ */
+int compactarTabuleiroDinamico(const TabuleiroDinamico *origem, TabuleiroBits *destino) {
+    if (origem->largura != TAMANHO_TABULEIRO || origem->altura != TAMANHO_TABULEIRO) {
+        return -1;
+    }
+
+    inicializarTabuleiroBits(destino);
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            unsigned char valor = *celulaDinamica(origem, i, j);
+            if (valor == NAVIO) {
+                destino->navios = bitboardOu(destino->navios, bitboardCelula(INDICE_CELULA(i, j)));
+            } else if (valor == HABILIDADE) {
+                destino->habilidade = bitboardOu(destino->habilidade,
+                                                 bitboardCelula(INDICE_CELULA(i, j)));
+            }
+        }
+    }
+    destino->hash = hashTabuleiroBits(destino);
+    return 0;
+}
@@ -0,0 +1,181 @@
+/*
+ * Arquivo: src/transposicao.c
+ * Descrição: Tabela de transposição sem travas, indexada por hashes de 64 bits
+ */
+
+#include "batalha_naval_interno.h"
+
+#include <stdatomic.h>
+
+// ========== TABELA DE TRANSPOSIÇÃO ==========
+
+// Cabeçalho de cada entrada: [versão, chave], seguido das palavras de dados
+#define PALAVRAS_CABECALHO_ENTRADA 2
+
+#define PALAVRAS_LINHA_CACHE (ALINHAMENTO_CACHE / (int)sizeof(uint64_t))
+
+/*
+ * Tipo: TabelaTransposicao
+ * Campos:
+ *   - palavras: entradas * passo palavras; cada entrada é [versão, chave, dados...]
+ *   - mascara: entradas - 1 (a quantidade de entradas é potência de 2)
+ *   - quantidadeDados: palavras de dados por entrada
+ *   - passo: palavras por entrada, arredondado para linhas de cache inteiras
+ * Lógica: Cada entrada é protegida por um "seqlock" na palavra de versão, que é
+ *         ímpar durante uma escrita e 0 em uma entrada nunca gravada. O escritor
+ *         reserva a entrada trocando a versão par por ímpar (CAS; se outro escritor
+ *         já a reservou, a gravação é descartada), grava chave e dados e publica a
+ *         versão par seguinte com release. O leitor lê a versão com acquire, copia
+ *         chave e dados e relê a versão: se ela era ímpar ou mudou, a leitura pode
+ *         ter misturado duas escritas e a consulta falha. Não há travas, e uma
+ *         entrada aceita é sempre a cópia exata de uma única gravação.
+ */
+struct TabelaTransposicao {
+    _Atomic uint64_t *palavras;
+    size_t mascara;
+    int quantidadeDados;
+    int passo;
+};
+
+/*
+ * Função: criarTabelaTransposicao
+ * Propósito: Cria uma tabela vazia
+ * Parâmetros:
+ *   - entradas: quantidade de entradas (arredondada para a potência de 2 seguinte)
+ *   - palavras: palavras de 64 bits de dados por entrada (1 ou mais)
+ * Retorno: tabela criada, ou NULL se os parâmetros forem inválidos ou faltar memória
+ */
+TabelaTransposicao *criarTabelaTransposicao(size_t entradas, int palavras) {
+    TabelaTransposicao *tabela;
+    size_t capacidade = 1;
+    int passo;
+
+    if (entradas == 0 || palavras < 1 || palavras > INT32_MAX - PALAVRAS_LINHA_CACHE) {
+        return NULL;
+    }
+    while (capacidade < entradas) {
+        if (capacidade > SIZE_MAX / 2) {
+            return NULL;
+        }
+        capacidade *= 2;
+    }
+    passo = (PALAVRAS_CABECALHO_ENTRADA + palavras + PALAVRAS_LINHA_CACHE - 1) / PALAVRAS_LINHA_CACHE * PALAVRAS_LINHA_CACHE;
+    if (capacidade > SIZE_MAX / sizeof(uint64_t) / (size_t)passo) {
+        return NULL;
+    }
+
+    tabela = malloc(sizeof(TabelaTransposicao));
+    if (tabela == NULL) {
+        return NULL;
+    }
+    tabela->palavras = alocarAlinhado(capacidade * (size_t)passo * sizeof(uint64_t));
+    if (tabela->palavras == NULL) {
+        free(tabela);
+        return NULL;
+    }
+    tabela->mascara = capacidade - 1;
+    tabela->quantidadeDados = palavras;
+    tabela->passo = passo;
+    limparTabelaTransposicao(tabela);
+    return tabela;
+}
+
+/*
+ * Função: consultarTransposicao
+ * Propósito: Procura a entrada de uma chave
+ * Parâmetros:
+ *   - tabela: tabela de transposição
+ *   - chave: hash da posição
+ *   - dados: recebe as palavras de dados (conteúdo indefinido se não encontrar)
+ * Retorno: 1 se a entrada existir e estiver íntegra, 0 caso contrário
+ * Nota: Pode ser chamada por várias threads, junto com gravarTransposicao.
+ */
+int consultarTransposicao(const TabelaTransposicao *tabela, uint64_t chave, uint64_t *dados) {
+    _Atomic uint64_t *entrada = &tabela->palavras[(chave & tabela->mascara) * (size_t)tabela->passo];
+    uint64_t versao = atomic_load_explicit(&entrada[0], memory_order_acquire);
+
+    if (versao == 0 || (versao & 1) != 0) {
+        return 0;  // Entrada vazia ou escrita em andamento
+    }
+    uint64_t chaveEntrada = atomic_load_explicit(&entrada[1], memory_order_relaxed);
+    for (int i = 0; i < tabela->quantidadeDados; i++) {
+        dados[i] = atomic_load_explicit(&entrada[PALAVRAS_CABECALHO_ENTRADA + i],
+                                        memory_order_relaxed);
+    }
+    // As leituras acima terminam antes da releitura da versão
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&entrada[0], memory_order_relaxed) == versao &&
+           chaveEntrada == chave;
+}
+
+/*
+ * Função: gravarTransposicao
+ * Propósito: Grava (ou substitui) a entrada do índice da chave
+ * Parâmetros:
+ *   - tabela: tabela de transposição
+ *   - chave: hash da posição
+ *   - dados: palavras de dados
+ * Retorno: void (não retorna valor)
+ * Nota: Se outra thread estiver gravando no mesmo índice, esta gravação é
+ *       descartada (o cache apenas deixa de guardar este resultado).
+ */
+void gravarTransposicao(TabelaTransposicao *tabela, uint64_t chave, const uint64_t *dados) {
+    _Atomic uint64_t *entrada = &tabela->palavras[(chave & tabela->mascara) * (size_t)tabela->passo];
+    uint64_t versao = atomic_load_explicit(&entrada[0], memory_order_relaxed);
+
+    // Reserva a entrada: versão par -> ímpar
+    if ((versao & 1) != 0 ||
+        !atomic_compare_exchange_strong_explicit(&entrada[0], &versao, versao + 1,
+                                                 memory_order_relaxed, memory_order_relaxed)) {
+        return;
+    }
+    // As gravações abaixo não podem ser vistas antes da versão ímpar
+    atomic_thread_fence(memory_order_release);
+
+    atomic_store_explicit(&entrada[1], chave, memory_order_relaxed);
+    for (int i = 0; i < tabela->quantidadeDados; i++) {
+        atomic_store_explicit(&entrada[PALAVRAS_CABECALHO_ENTRADA + i], dados[i],
+                              memory_order_relaxed);
+    }
+    // Publica: as gravações acima ficam visíveis antes da nova versão par
+    atomic_store_explicit(&entrada[0], versao + 2, memory_order_release);
+}
+
+/*
+ * Função: limparTabelaTransposicao
+ * Propósito: Esvazia todas as entradas
+ * Parâmetros:
+ *   - tabela: tabela de transposição (sem consultas ou gravações em andamento)
+ * Retorno: void (não retorna valor)
+ */
+void limparTabelaTransposicao(TabelaTransposicao *tabela) {
+    size_t total = (tabela->mascara + 1) * (size_t)tabela->passo;
+    for (size_t i = 0; i < total; i++) {
+        atomic_store_explicit(&tabela->palavras[i], 0, memory_order_relaxed);
+    }
+}
+
+/*
+ * Função: palavrasTabelaTransposicao
+ * Propósito: Informa quantas palavras de dados cada entrada guarda
+ * Parâmetros:
+ *   - tabela: tabela de transposição
+ * Retorno: palavras de dados por entrada
+ */
+int palavrasTabelaTransposicao(const TabelaTransposicao *tabela) {
+    return tabela->quantidadeDados;
+}
+
+/*
+ * Função: destruirTabelaTransposicao
+ * Propósito: Libera a tabela
+ * Parâmetros:
+ *   - tabela: tabela de transposição (NULL é ignorado)
+ * Retorno: void (não retorna valor)
+ */
+void destruirTabelaTransposicao(TabelaTransposicao *tabela) {
+    if (tabela != NULL) {
+        liberarAlinhado((void *)tabela->palavras);
+        free(tabela);
+    }
+}
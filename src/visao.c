@@ -0,0 +1,347 @@
+/*
+ * Arquivo: src/visao.c
+ * Descrição: Visões do atacante derivadas das camadas do defensor e áreas de
+ *            habilidade internadas, compartilhadas entre as visões
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== VISÃO DO ATACANTE ==========
+
+#define BITS_FRAGMENTO_CAMADAS 4    // 16 fragmentos no registro de camadas
+#define QUANTIDADE_FRAGMENTOS_CAMADAS (1 << BITS_FRAGMENTO_CAMADAS)
+#define BALDES_INICIAIS_FRAGMENTO 16  // Baldes por fragmento antes do primeiro crescimento
+
+/*
+ * Tipo: FragmentoCamadas
+ * Propósito: Uma fatia do registro, escolhida pelos bits baixos do hash da camada
+ * Campos:
+ *   - trava: protege os baldes e a contagem de referências das camadas
+ *   - baldes: listas de camadas, indexadas pelos bits seguintes do hash
+ *   - quantidadeBaldes: potência de 2 (0 antes da primeira camada)
+ *   - quantidade: camadas no fragmento
+ */
+typedef struct {
+    _Alignas(ALINHAMENTO_CACHE) pthread_mutex_t trava;
+    CamadaHabilidade **baldes;
+    size_t quantidadeBaldes;
+    size_t quantidade;
+} FragmentoCamadas;
+
+/*
+ * Tipo: RegistroCamadas
+ * Campos:
+ *   - fragmentos: camadas divididas por fragmento, cada um com a própria trava
+ */
+struct RegistroCamadas {
+    FragmentoCamadas fragmentos[QUANTIDADE_FRAGMENTOS_CAMADAS];
+};
+
+// Trechos fixos da visão formatada (TAMANHO_TABULEIRO de um dígito)
+static const char CABECALHO_VISAO[] =
+    "\n=== VISAO DO ATACANTE ===\n\n    0 1 2 3 4 5 6 7 8 9\n";
+static const char LEGENDA_VISAO[] =
+    "\nLegenda: ~ = Desconhecida, o = Agua, X = Acerto, * = Previa de Habilidade\n";
+
+// Texto de cada ValorVisao (espaço + glifo)
+static const char GLIFOS_VISAO[4][2] = {{' ', '~'}, {' ', 'o'}, {' ', 'X'}, {' ', '*'}};
+static const char DIGITOS_LINHA[] = "0123456789";
+
+static FragmentoCamadas *fragmentoDoHash(RegistroCamadas *registro, uint64_t hash) {
+    return &registro->fragmentos[hash & (QUANTIDADE_FRAGMENTOS_CAMADAS - 1)];
+}
+
+static size_t baldeDoHash(const FragmentoCamadas *fragmento, uint64_t hash) {
+    return (size_t)(hash >> BITS_FRAGMENTO_CAMADAS) & (fragmento->quantidadeBaldes - 1);
+}
+
+// Dobra os baldes do fragmento (com a trava já obtida); -1 se faltar memória
+static int crescerFragmento(FragmentoCamadas *fragmento) {
+    size_t quantidade = fragmento->quantidadeBaldes ? fragmento->quantidadeBaldes * 2
+                                                    : BALDES_INICIAIS_FRAGMENTO;
+    CamadaHabilidade **baldes = calloc(quantidade, sizeof(CamadaHabilidade *));
+    size_t antigos = fragmento->quantidadeBaldes;
+
+    if (baldes == NULL) {
+        return -1;
+    }
+    fragmento->quantidadeBaldes = quantidade;
+    for (size_t b = 0; b < antigos; b++) {
+        CamadaHabilidade *camada = fragmento->baldes[b];
+        while (camada != NULL) {
+            CamadaHabilidade *proxima = camada->proxima;
+            size_t destino = baldeDoHash(fragmento, camada->hash);
+            camada->proxima = baldes[destino];
+            baldes[destino] = camada;
+            camada = proxima;
+        }
+    }
+    free(fragmento->baldes);
+    fragmento->baldes = baldes;
+    return 0;
+}
+
+/*
+ * Função: criarRegistroCamadas
+ * Propósito: Cria um registro vazio de camadas de habilidade
+ * Parâmetros: nenhum
+ * Retorno: registro criado, ou NULL se faltar memória
+ * Nota: Pode ser usado por várias threads ao mesmo tempo.
+ */
+RegistroCamadas *criarRegistroCamadas(void) {
+    RegistroCamadas *registro = alocarAlinhado(sizeof(RegistroCamadas));
+    if (registro == NULL) {
+        return NULL;
+    }
+    for (int f = 0; f < QUANTIDADE_FRAGMENTOS_CAMADAS; f++) {
+        pthread_mutex_init(&registro->fragmentos[f].trava, NULL);
+        registro->fragmentos[f].baldes = NULL;
+        registro->fragmentos[f].quantidadeBaldes = 0;
+        registro->fragmentos[f].quantidade = 0;
+    }
+    return registro;
+}
+
+/*
+ * Função: internarCamadaHabilidade
+ * Propósito: Obtém a camada única de um conjunto de células, criando-a se preciso
+ * Parâmetros:
+ *   - registro: registro de camadas
+ *   - celulas: células da área de habilidade
+ * Retorno: camada com uma referência a mais (devolvida com soltarCamadaHabilidade),
+ *          ou NULL se faltar memória
+ * Lógica: O hash de Zobrist escolhe o fragmento e o balde; só a trava desse
+ *         fragmento é obtida, e a comparação final é feita nas próprias células.
+ */
+const CamadaHabilidade *internarCamadaHabilidade(RegistroCamadas *registro, Bitboard celulas) {
+    uint64_t hash = hashCamadaZobrist(ZOBRIST_HABILIDADE, celulas);
+    FragmentoCamadas *fragmento = fragmentoDoHash(registro, hash);
+    CamadaHabilidade *camada = NULL;
+
+    pthread_mutex_lock(&fragmento->trava);
+    if (fragmento->quantidadeBaldes != 0) {
+        camada = fragmento->baldes[baldeDoHash(fragmento, hash)];
+        while (camada != NULL && (camada->hash != hash ||
+                                  camada->celulas.palavra[0] != celulas.palavra[0] ||
+                                  camada->celulas.palavra[1] != celulas.palavra[1])) {
+            camada = camada->proxima;
+        }
+    }
+    if (camada != NULL) {
+        camada->referencias++;
+    } else if ((fragmento->quantidade < fragmento->quantidadeBaldes ||
+                crescerFragmento(fragmento) == 0) &&
+               (camada = malloc(sizeof(CamadaHabilidade))) != NULL) {
+        size_t balde = baldeDoHash(fragmento, hash);
+        camada->celulas = celulas;
+        camada->hash = hash;
+        camada->referencias = 1;
+        camada->proxima = fragmento->baldes[balde];
+        fragmento->baldes[balde] = camada;
+        fragmento->quantidade++;
+    }
+    pthread_mutex_unlock(&fragmento->trava);
+    return camada;
+}
+
+/*
+ * Função: reterCamadaHabilidade
+ * Propósito: Acrescenta uma referência a uma camada já internada (por exemplo, ao
+ *            copiar uma visão)
+ * Parâmetros:
+ *   - registro: registro que internou a camada
+ *   - camada: camada internada (NULL é ignorado)
+ * Retorno: void (não retorna valor)
+ */
+void reterCamadaHabilidade(RegistroCamadas *registro, const CamadaHabilidade *camada) {
+    FragmentoCamadas *fragmento;
+
+    if (camada == NULL) {
+        return;
+    }
+    fragmento = fragmentoDoHash(registro, camada->hash);
+    pthread_mutex_lock(&fragmento->trava);
+    ((CamadaHabilidade *)camada)->referencias++;
+    pthread_mutex_unlock(&fragmento->trava);
+}
+
+/*
+ * Função: soltarCamadaHabilidade
+ * Propósito: Devolve uma referência; a camada é liberada quando nenhuma visão a usa
+ * Parâmetros:
+ *   - registro: registro que internou a camada
+ *   - camada: camada internada (NULL é ignorado)
+ * Retorno: void (não retorna valor)
+ */
+void soltarCamadaHabilidade(RegistroCamadas *registro, const CamadaHabilidade *camada) {
+    FragmentoCamadas *fragmento;
+    CamadaHabilidade **elo;
+
+    if (camada == NULL) {
+        return;
+    }
+    fragmento = fragmentoDoHash(registro, camada->hash);
+    pthread_mutex_lock(&fragmento->trava);
+    if (--((CamadaHabilidade *)camada)->referencias == 0) {
+        elo = &fragmento->baldes[baldeDoHash(fragmento, camada->hash)];
+        while (*elo != camada) {
+            elo = &(*elo)->proxima;
+        }
+        *elo = camada->proxima;
+        fragmento->quantidade--;
+        free((void *)camada);
+    }
+    pthread_mutex_unlock(&fragmento->trava);
+}
+
+/*
+ * Função: quantidadeCamadasInternadas
+ * Propósito: Conta as camadas distintas em uso
+ * Parâmetros:
+ *   - registro: registro de camadas
+ * Retorno: quantidade de camadas no registro
+ */
+size_t quantidadeCamadasInternadas(RegistroCamadas *registro) {
+    size_t total = 0;
+    for (int f = 0; f < QUANTIDADE_FRAGMENTOS_CAMADAS; f++) {
+        pthread_mutex_lock(&registro->fragmentos[f].trava);
+        total += registro->fragmentos[f].quantidade;
+        pthread_mutex_unlock(&registro->fragmentos[f].trava);
+    }
+    return total;
+}
+
+/*
+ * Função: destruirRegistroCamadas
+ * Propósito: Libera o registro e as camadas que ainda restarem nele
+ * Parâmetros:
+ *   - registro: registro de camadas (NULL é ignorado)
+ * Retorno: void (não retorna valor)
+ * Nota: Nenhuma visão pode continuar apontando para as camadas do registro.
+ */
+void destruirRegistroCamadas(RegistroCamadas *registro) {
+    if (registro == NULL) {
+        return;
+    }
+    for (int f = 0; f < QUANTIDADE_FRAGMENTOS_CAMADAS; f++) {
+        FragmentoCamadas *fragmento = &registro->fragmentos[f];
+        for (size_t b = 0; b < fragmento->quantidadeBaldes; b++) {
+            CamadaHabilidade *camada = fragmento->baldes[b];
+            while (camada != NULL) {
+                CamadaHabilidade *proxima = camada->proxima;
+                free(camada);
+                camada = proxima;
+            }
+        }
+        free(fragmento->baldes);
+        pthread_mutex_destroy(&fragmento->trava);
+    }
+    liberarAlinhado(registro);
+}
+
+/*
+ * Função: iniciarVisaoAtacante
+ * Propósito: Liga uma visão às camadas do defensor e do atacante, sem prévia
+ * Parâmetros:
+ *   - visao: visão a iniciar
+ *   - navios: camada de navios do defensor
+ *   - tiros: camada de tiros do atacante contra esse defensor
+ * Retorno: void (não retorna valor)
+ */
+void iniciarVisaoAtacante(VisaoAtacante *visao, const Bitboard *navios, const Bitboard *tiros) {
+    visao->navios = navios;
+    visao->tiros = tiros;
+    visao->previa = NULL;
+}
+
+/*
+ * Função: previsualizarFormaVisao
+ * Propósito: Mostra na visão a área que uma habilidade cobriria, substituindo a
+ *            prévia anterior
+ * Parâmetros:
+ *   - visao: visão do atacante
+ *   - registro: registro onde a área é internada
+ *   - forma: forma obtida com obterForma
+ *   - origem_linha, origem_coluna: centro da área no tabuleiro
+ * Retorno: 0 em caso de sucesso, -1 se faltar memória (a prévia anterior é mantida)
+ */
+int previsualizarFormaVisao(VisaoAtacante *visao, RegistroCamadas *registro,
+                            const FormaHabilidade *forma, int origem_linha, int origem_coluna) {
+    const CamadaHabilidade *camada =
+        internarCamadaHabilidade(registro, mascaraForma(forma, origem_linha, origem_coluna));
+    if (camada == NULL) {
+        return -1;
+    }
+    soltarCamadaHabilidade(registro, visao->previa);
+    visao->previa = camada;
+    return 0;
+}
+
+/*
+ * Função: limparPreviaVisao
+ * Propósito: Remove a prévia de habilidade da visão
+ * Parâmetros:
+ *   - visao: visão do atacante
+ *   - registro: registro onde a prévia foi internada
+ * Retorno: void (não retorna valor)
+ */
+void limparPreviaVisao(VisaoAtacante *visao, RegistroCamadas *registro) {
+    soltarCamadaHabilidade(registro, visao->previa);
+    visao->previa = NULL;
+}
+
+/*
+ * Função: celulasVisao
+ * Propósito: Todas as células da visão com um dado valor, de uma só vez
+ * Parâmetros:
+ *   - visao: visão do atacante
+ *   - valor: valor procurado
+ * Retorno: máscara das células; custa algumas operações sobre as camadas,
+ *          sem percorrer célula por célula
+ */
+Bitboard celulasVisao(const VisaoAtacante *visao, ValorVisao valor) {
+    Bitboard previa = visao->previa != NULL ? visao->previa->celulas : bitboardVazio();
+    Bitboard todas = {{~0ULL, (1ULL << (CELULAS_TABULEIRO - 64)) - 1}};
+
+    switch (valor) {
+        case VISAO_AGUA:
+            return bitboardENao(*visao->tiros, *visao->navios);
+        case VISAO_ACERTO:
+            return bitboardE(*visao->tiros, *visao->navios);
+        case VISAO_PREVIA:
+            return bitboardENao(previa, *visao->tiros);
+        case VISAO_DESCONHECIDA:
+        default:
+            return bitboardENao(todas, bitboardOu(*visao->tiros, previa));
+    }
+}
+
+/*
+ * Função: formatarVisao
+ * Propósito: Escreve a visão inteira, no formato de formatarTabuleiroBits, em um buffer
+ * Parâmetros:
+ *   - visao: visão do atacante
+ *   - buffer: destino com pelo menos TAMANHO_BUFFER_VISAO bytes
+ * Retorno: quantidade de bytes escritos (sem terminador nulo)
+ */
+size_t formatarVisao(const VisaoAtacante *visao, char *buffer) {
+    char *escrita = buffer;
+
+    memcpy(escrita, CABECALHO_VISAO, sizeof(CABECALHO_VISAO) - 1);
+    escrita += sizeof(CABECALHO_VISAO) - 1;
+
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        *escrita++ = DIGITOS_LINHA[i];  // Número da linha
+        *escrita++ = ' ';
+        *escrita++ = ' ';
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            memcpy(escrita, GLIFOS_VISAO[consultarVisao(visao, INDICE_CELULA(i, j))], 2);
+            escrita += 2;
+        }
+        *escrita++ = '\n';
+    }
+
+    memcpy(escrita, LEGENDA_VISAO, sizeof(LEGENDA_VISAO) - 1);
+    escrita += sizeof(LEGENDA_VISAO) - 1;
+    return (size_t)(escrita - buffer);
+}
@@ -0,0 +1,71 @@
+/*
+ * Arquivo: src/zobrist.c
+ * Descrição: Chaves e hashes de Zobrist do tabuleiro e das observações do atirador
+ */
+
+#include "batalha_naval_interno.h"
+
+// ========== HASH DE ZOBRIST ==========
+
+// Semente fixa: os hashes são os mesmos em toda execução e em toda plataforma
+#define SEMENTE_ZOBRIST 0x5A0B7157BA7A1AULL
+
+static uint64_t chavesZobrist[QUANTIDADE_CAMADAS_ZOBRIST][CELULAS_TABULEIRO];
+static pthread_once_t criacaoChavesZobrist = PTHREAD_ONCE_INIT;
+
+static void criarChavesZobrist(void) {
+    uint64_t semente = SEMENTE_ZOBRIST;
+    for (int camada = 0; camada < QUANTIDADE_CAMADAS_ZOBRIST; camada++) {
+        for (int c = 0; c < CELULAS_TABULEIRO; c++) {
+            chavesZobrist[camada][c] = splitmix64(&semente);
+        }
+    }
+}
+
+/*
+ * Função: hashCamadaZobrist
+ * Propósito: Hash de um conjunto de células em uma camada
+ * Parâmetros:
+ *   - camada: conjunto de chaves usado
+ *   - celulas: células do conjunto
+ * Retorno: XOR das chaves das células (0 para o conjunto vazio)
+ * Nota: Aplicada às células alteradas por uma operação, dá a diferença a ser
+ *       aplicada com XOR no hash do tabuleiro; o custo é um XOR por célula alterada.
+ */
+uint64_t hashCamadaZobrist(CamadaZobrist camada, Bitboard celulas) {
+    const uint64_t *chaves = chavesZobrist[camada];
+    uint64_t hash = 0;
+
+    pthread_once(&criacaoChavesZobrist, criarChavesZobrist);
+    for (int p = 0; p < 2; p++) {
+        for (uint64_t bits = celulas.palavra[p]; bits; bits &= bits - 1) {
+            hash ^= chaves[p * 64 + __builtin_ctzll(bits)];
+        }
+    }
+    return hash;
+}
+
+/*
+ * Função: hashTabuleiroBits
+ * Propósito: Calcula do zero o hash das três camadas de um tabuleiro em bits
+ * Parâmetros:
+ *   - tabuleiro: tabuleiro em bits
+ * Retorno: hash de Zobrist (igual ao campo hash mantido pelas operações)
+ */
+uint64_t hashTabuleiroBits(const TabuleiroBits *tabuleiro) {
+    return hashCamadaZobrist(ZOBRIST_NAVIOS, tabuleiro->navios) ^
+           hashCamadaZobrist(ZOBRIST_HABILIDADE, tabuleiro->habilidade) ^
+           hashCamadaZobrist(ZOBRIST_TIROS, tabuleiro->tiros);
+}
+
+/*
+ * Função: hashObservacao
+ * Propósito: Hash do que o atirador sabe sobre o tabuleiro adversário
+ * Parâmetros:
+ *   - agua: tiros que caíram na água
+ *   - acertos: tiros que acertaram navios
+ * Retorno: hash de Zobrist das observações (chave do cache do solucionador)
+ */
+uint64_t hashObservacao(Bitboard agua, Bitboard acertos) {
+    return hashCamadaZobrist(ZOBRIST_AGUA, agua) ^ hashCamadaZobrist(ZOBRIST_ACERTO, acertos);
+}